@@ -0,0 +1,313 @@
+/*******************************************************************************
+ *
+ * @file      DeviceMemoryBenchmark.cpp
+ * @brief     Stress tests and times the DeviceMemoryAllocator against the
+ *            in-process fake device, so it runs on machines without a GPU
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Graphics/DeviceMemoryAllocator.hpp>
+#include <Junia/Graphics/DeviceMemoryRingBuffer.hpp>
+#include <Junia/Graphics/FakeDeviceMemoryBackend.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Junia;
+
+namespace {
+
+constexpr int           OPERATIONS   = 1000000;
+constexpr int           THREAD_COUNT = 4;
+constexpr std::uint64_t MiB          = 1024 * 1024;
+
+int g_failures = 0;
+
+/**
+ * @brief           print a failed check and remember it for the exit code
+ * @param condition the checked condition
+ * @param what      a description of the check
+ */
+void Check(bool condition, const char* what) {
+	if (condition) return;
+	std::printf("  FAILED: %s\n", what);
+	g_failures++;
+}
+
+/**
+ * @brief          fill host visible memory with a pattern derived from a tag
+ * @param   data   the memory
+ * @param   size   the size in bytes
+ * @param   tag    the tag of the allocation
+ */
+void Fill(void* data, std::uint64_t size, std::uint8_t tag) {
+	std::memset(data, tag, static_cast<std::size_t>(std::min<std::uint64_t>(size, 64)));
+}
+
+/**
+ * @brief          check that host visible memory still holds its pattern
+ * @param   data   the memory
+ * @param   size   the size in bytes
+ * @param   tag    the tag of the allocation
+ * @returns        true if no other allocation overwrote the memory
+ */
+bool Verify(const void* data, std::uint64_t size, std::uint8_t tag) {
+	const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+	for (std::uint64_t i = 0; i < std::min<std::uint64_t>(size, 64); i++) {
+		if (bytes[i] != tag) return false;
+	}
+	return true;
+}
+
+/**
+ * @brief        get a random allocation size with many small and few large
+ *               resources like in a typical scene
+ * @param   rng  the random number generator
+ * @returns      the size in bytes
+ */
+std::uint64_t RandomSize(std::mt19937_64& rng) {
+	std::uint64_t r = rng() % 100;
+	if (r < 70) return 256 + rng() % (64 * 1024);
+	if (r < 97) return 64 * 1024 + rng() % (4 * MiB);
+	return 8 * MiB + rng() % (48 * MiB);
+}
+
+void StressRandom() {
+	FakeDeviceMemoryBackend backend;
+	DeviceMemoryAllocator   allocator(backend);
+	std::mt19937_64         rng(7);
+
+	std::vector<DeviceMemoryAllocation*> live;
+	std::uint64_t                        liveBytes = 0;
+	bool                                 intact    = true;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < OPERATIONS; i++) {
+		if (live.size() < 64 || (live.size() < 4000 && liveBytes < 2048 * MiB && rng() % 2 == 0)) {
+			DeviceMemoryRequest request;
+			request.size           = RandomSize(rng);
+			request.alignment      = std::uint64_t(1) << (rng() % 12);
+			request.preferredFlags = rng() % 4 == 0 ? DeviceMemoryProperty::HOST_VISIBLE : DeviceMemoryProperty::DEVICE_LOCAL;
+			request.optimalImage   = rng() % 2 == 0;
+
+			DeviceMemoryAllocation* allocation = allocator.Allocate(request);
+			intact                             = intact && allocation->GetOffset() % request.alignment == 0;
+			if (allocation->GetMappedData()) Fill(allocation->GetMappedData(), allocation->GetSize(), static_cast<std::uint8_t>(i));
+			allocation->SetUserData(reinterpret_cast<void*>(static_cast<std::uintptr_t>(static_cast<std::uint8_t>(i))));
+			live.push_back(allocation);
+			liveBytes += allocation->GetSize();
+		} else {
+			std::size_t             index      = rng() % live.size();
+			DeviceMemoryAllocation* allocation = live[index];
+			if (allocation->GetMappedData()) intact = intact && Verify(allocation->GetMappedData(), allocation->GetSize(), static_cast<std::uint8_t>(reinterpret_cast<std::uintptr_t>(allocation->GetUserData())));
+			liveBytes -= allocation->GetSize();
+			allocator.Free(allocation);
+			live[index] = live.back();
+			live.pop_back();
+		}
+	}
+	auto   end = std::chrono::steady_clock::now();
+	double ns  = std::chrono::duration<double, std::nano>(end - start).count() / OPERATIONS;
+	std::printf("random allocate/free: %d operations, %.0f ns per operation\n", OPERATIONS, ns);
+
+	std::vector<DeviceMemoryStatistics> statistics = allocator.GetStatistics();
+	for (std::size_t heap = 0; heap < statistics.size(); heap++) {
+		const DeviceMemoryStatistics& s = statistics[heap];
+		std::printf("  heap %zu: %u blocks %8.1f MiB, %u allocations %8.1f MiB (%.1f%% used), budget %.1f/%.1f MiB\n", heap, s.blockCount, s.blockBytes / double(MiB), s.allocationCount,
+			s.allocationBytes / double(MiB), s.blockBytes ? 100.0 * s.allocationBytes / s.blockBytes : 0.0, s.usage / double(MiB), s.budget / double(MiB));
+	}
+	std::printf("  device memory allocations: %llu\n", static_cast<unsigned long long>(backend.GetTotalAllocationCount()));
+	Check(intact, "allocations are aligned and do not overlap");
+
+	for (DeviceMemoryAllocation* allocation : live) allocator.Free(allocation);
+	statistics = allocator.GetStatistics();
+	for (const DeviceMemoryStatistics& s : statistics) Check(s.allocationCount == 0 && s.allocationBytes == 0, "statistics are empty after freeing everything");
+	Check(backend.GetMisuseCount() == 0, "device memory is freed and unmapped correctly");
+}
+
+void StressDefragment() {
+	FakeDeviceMemoryBackend backend;
+	DeviceMemoryAllocator   allocator(backend, 16 * MiB);
+	std::mt19937_64         rng(11);
+
+	std::vector<DeviceMemoryAllocation*> live;
+	for (int i = 0; i < 20000; i++) {
+		DeviceMemoryRequest request;
+		request.size          = 1024 + rng() % (64 * 1024);
+		request.alignment     = 256;
+		request.requiredFlags = DeviceMemoryProperty::HOST_VISIBLE;
+		request.userData      = reinterpret_cast<void*>(static_cast<std::uintptr_t>(static_cast<std::uint8_t>(i)));
+
+		DeviceMemoryAllocation* allocation = allocator.Allocate(request);
+		Fill(allocation->GetMappedData(), allocation->GetSize(), static_cast<std::uint8_t>(i));
+		live.push_back(allocation);
+	}
+	for (std::size_t i = 0; i < live.size();) {
+		if (rng() % 4 != 0) {
+			allocator.Free(live[i]);
+			live[i] = live.back();
+			live.pop_back();
+		} else {
+			i++;
+		}
+	}
+
+	std::uint32_t before = 0;
+	for (const DeviceMemoryStatistics& s : allocator.GetStatistics()) before += s.blockCount;
+
+	auto                        start  = std::chrono::steady_clock::now();
+	DeviceMemoryDefragmentation result = allocator.Defragment([](const DeviceMemoryMove& move) {
+		std::memcpy(move.dstData, move.srcData, static_cast<std::size_t>(move.size));
+	});
+	auto                        end    = std::chrono::steady_clock::now();
+
+	std::uint32_t after = 0;
+	for (const DeviceMemoryStatistics& s : allocator.GetStatistics()) after += s.blockCount;
+	std::printf("defragment: %u -> %u blocks, moved %u allocations (%.1f MiB), freed %u blocks (%.1f MiB) in %.2f ms\n", before, after, result.movedAllocations,
+		result.movedBytes / double(MiB), result.freedBlocks, result.freedBytes / double(MiB), std::chrono::duration<double, std::milli>(end - start).count());
+
+	bool intact = true;
+	for (DeviceMemoryAllocation* allocation : live) intact = intact && Verify(allocation->GetMappedData(), allocation->GetSize(), static_cast<std::uint8_t>(reinterpret_cast<std::uintptr_t>(allocation->GetUserData())));
+	Check(intact, "moved allocations keep their data");
+	Check(after < before, "defragmentation frees blocks");
+	for (DeviceMemoryAllocation* allocation : live) allocator.Free(allocation);
+}
+
+void StressThreads() {
+	FakeDeviceMemoryBackend backend;
+	DeviceMemoryAllocator   allocator(backend);
+
+	auto                     start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int t = 0; t < THREAD_COUNT; t++) {
+		threads.emplace_back([&allocator, t] {
+			std::mt19937_64                      rng(100 + t);
+			std::vector<DeviceMemoryAllocation*> live;
+			for (int i = 0; i < OPERATIONS / THREAD_COUNT; i++) {
+				if (live.size() < 500 && rng() % 2 == 0) {
+					DeviceMemoryRequest request;
+					request.size = 256 + rng() % (256 * 1024);
+					live.push_back(allocator.Allocate(request));
+				} else if (!live.empty()) {
+					std::size_t index = rng() % live.size();
+					allocator.Free(live[index]);
+					live[index] = live.back();
+					live.pop_back();
+				}
+			}
+			for (DeviceMemoryAllocation* allocation : live) allocator.Free(allocation);
+		});
+	}
+	for (std::thread& thread : threads) thread.join();
+	auto end = std::chrono::steady_clock::now();
+	std::printf("%d threads: %.0f ns per operation\n", THREAD_COUNT, std::chrono::duration<double, std::nano>(end - start).count() / OPERATIONS);
+
+	for (const DeviceMemoryStatistics& s : allocator.GetStatistics()) Check(s.allocationCount == 0, "all threads freed their allocations");
+}
+
+void StressFailures() {
+	FakeDeviceMemoryBackend backend(
+		{
+			{ DeviceMemoryProperty::DEVICE_LOCAL, 0 },
+			{ DeviceMemoryProperty::HOST_VISIBLE | DeviceMemoryProperty::HOST_COHERENT, 1 },
+		},
+		{
+			{ 256 * MiB, true },
+			{ 256 * MiB, false },
+		},
+		1, 64);
+	DeviceMemoryAllocator allocator(backend);
+
+	DeviceMemoryRequest request;
+	request.size           = 1 * MiB;
+	request.preferredFlags = DeviceMemoryProperty::DEVICE_LOCAL;
+
+	// failed block allocations are retried with smaller blocks
+	backend.FailNextAllocations(2);
+	DeviceMemoryAllocation* halved = allocator.Allocate(request);
+	Check(halved->GetMemoryType() == 0 && allocator.GetStatistics()[0].blockBytes == 8 * MiB, "failed blocks are retried at half the size");
+
+	// device local memory over budget falls back to host memory
+	backend.SetBudget(0, 8 * MiB);
+	std::vector<DeviceMemoryAllocation*> live { halved };
+	for (int i = 0; i < 16; i++) live.push_back(allocator.Allocate(request));
+	Check(live.back()->GetMemoryType() == 1, "allocations over budget fall back to other memory types");
+
+	bool thrown = false;
+	try {
+		request.requiredFlags = DeviceMemoryProperty::DEVICE_LOCAL;
+		request.size          = 64 * MiB;
+		live.push_back(allocator.Allocate(request));
+	} catch (const ExDeviceMemory&) {
+		thrown = true;
+	}
+	Check(thrown, "allocations over budget without fallback throw");
+
+	for (DeviceMemoryAllocation* allocation : live) allocator.Free(allocation);
+}
+
+void StressRingBuffer() {
+	FakeDeviceMemoryBackend backend;
+	DeviceMemoryAllocator   allocator(backend);
+	DeviceMemoryRingBuffer  ring(allocator, 16 * MiB);
+	std::mt19937_64         rng(3);
+
+	constexpr int FRAMES_IN_FLIGHT = 3;
+	std::uint64_t allocations      = 0;
+	bool          overflow         = false;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < 10000; frame++) {
+		std::uint64_t budget = 2 * MiB + rng() % (2 * MiB);
+		for (std::uint64_t used = 0; used < budget;) {
+			std::uint64_t size = 64 + rng() % (16 * 1024);
+			try {
+				DeviceMemorySlice slice = ring.Allocate(size, 256);
+				std::memset(slice.data, frame, static_cast<std::size_t>(size));
+			} catch (const ExDeviceMemory&) {
+				overflow = true;
+			}
+			used += size;
+			allocations++;
+		}
+		ring.EndFrame();
+		if (frame >= FRAMES_IN_FLIGHT - 1) ring.ReleaseFrame();
+	}
+	auto end = std::chrono::steady_clock::now();
+	std::printf("ring buffer: %llu allocations, %.1f ns per allocation\n", static_cast<unsigned long long>(allocations), std::chrono::duration<double, std::nano>(end - start).count() / allocations);
+	Check(!overflow, "frames in flight fit into the ring buffer");
+
+	while (ring.ReleaseFrame()) { }
+	Check(ring.GetUsedSize() == 0, "released frames free all memory");
+
+	ring.Reset();
+	bool thrown = false;
+	try {
+		for (int i = 0; i < 17; i++) (void) ring.Allocate(MiB);
+	} catch (const ExDeviceMemory&) {
+		thrown = true;
+	}
+	Check(thrown, "a full ring buffer throws");
+}
+
+} // namespace
+
+int main() {
+	StressRandom();
+	StressDefragment();
+	StressThreads();
+	StressFailures();
+	StressRingBuffer();
+
+	if (g_failures != 0) std::printf("%d checks failed\n", g_failures);
+	return g_failures == 0 ? 0 : 1;
+}
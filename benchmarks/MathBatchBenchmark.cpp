@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * @file      MathBatchBenchmark.cpp
+ * @brief     Compares the batched math kernels against straightforward scalar
+ *            array-of-structures loops
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Math/Math.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Junia;
+
+namespace {
+
+constexpr std::size_t POINT_COUNT = 100000;
+constexpr std::size_t NODE_COUNT  = 10000;
+constexpr int         ITERATIONS  = 100;
+
+volatile float g_sink = 0.0f;
+
+/**
+ * @brief         measure the average duration of a function
+ * @param   name  the name that is printed
+ * @param   func  the function to measure
+ * @returns       the average duration of one call in microseconds
+ */
+template <typename TFunc>
+double Measure(const char* name, TFunc&& func) {
+	func();
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < ITERATIONS; i++) func();
+	auto   end = std::chrono::steady_clock::now();
+	double us  = std::chrono::duration<double, std::micro>(end - start).count() / ITERATIONS;
+	std::printf("  %-28s %10.1f us\n", name, us);
+	return us;
+}
+
+/**
+ * @brief transform a point without any SIMD instructions
+ */
+Vec3 ScalarTransformPoint(const Mat4& m, const Vec3& p) {
+	return Vec3(
+		m[0].x * p.x + m[1].x * p.y + m[2].x * p.z + m[3].x,
+		m[0].y * p.x + m[1].y * p.y + m[2].y * p.z + m[3].y,
+		m[0].z * p.x + m[1].z * p.y + m[2].z * p.z + m[3].z);
+}
+
+/**
+ * @brief multiply two matrices without any SIMD instructions
+ */
+Mat4 ScalarMultiply(const Mat4& a, const Mat4& b) {
+	Mat4 r;
+	for (int c = 0; c < 4; c++) {
+		const Vec4& bc = b[c];
+		r[c]           = Vec4(
+			a[0].x * bc.x + a[1].x * bc.y + a[2].x * bc.z + a[3].x * bc.w,
+			a[0].y * bc.x + a[1].y * bc.y + a[2].y * bc.z + a[3].y * bc.w,
+			a[0].z * bc.x + a[1].z * bc.y + a[2].z * bc.z + a[3].z * bc.w,
+			a[0].w * bc.x + a[1].w * bc.y + a[2].w * bc.z + a[3].w * bc.w);
+	}
+	return r;
+}
+
+} // namespace
+
+int main() {
+#if defined(JUNIA_MATH_AVX)
+	std::printf("instruction set: AVX\n");
+#elif defined(JUNIA_MATH_SSE)
+	std::printf("instruction set: SSE2\n");
+#else
+	std::printf("instruction set: scalar\n");
+#endif
+
+	std::mt19937                          rng(42);
+	std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+	std::vector<Vec3>  points(POINT_COUNT), transformed(POINT_COUNT);
+	std::vector<float> x(POINT_COUNT), y(POINT_COUNT), z(POINT_COUNT), radii(POINT_COUNT);
+	std::vector<float> ox(POINT_COUNT), oy(POINT_COUNT), oz(POINT_COUNT);
+	for (std::size_t i = 0; i < POINT_COUNT; i++) {
+		points[i] = Vec3(dist(rng), dist(rng), dist(rng));
+		x[i]      = points[i].x;
+		y[i]      = points[i].y;
+		z[i]      = points[i].z;
+		radii[i]  = std::abs(dist(rng)) * 0.05f;
+	}
+
+	Mat4 matrix = ComposeTransform(Vec3(1.0f, 2.0f, 3.0f), Quat::FromAxisAngle(Normalize(Vec3(1.0f, 1.0f, 0.0f)), 0.7f), Vec3(2.0f));
+
+	std::printf("transform %zu points\n", POINT_COUNT);
+	double scalar = Measure("scalar AoS", [&] {
+		for (std::size_t i = 0; i < POINT_COUNT; i++) transformed[i] = ScalarTransformPoint(matrix, points[i]);
+		g_sink = transformed[POINT_COUNT / 2].x;
+	});
+	double batch = Measure("MathBatch::TransformPoints", [&] {
+		MathBatch::TransformPoints(matrix, { x, y, z }, { ox, oy, oz });
+		g_sink = ox[POINT_COUNT / 2];
+	});
+	std::printf("  speedup %.2fx\n", scalar / batch);
+
+	std::vector<Mat4>         local(NODE_COUNT), world(NODE_COUNT);
+	std::vector<std::int32_t> parents(NODE_COUNT);
+	for (std::size_t i = 0; i < NODE_COUNT; i++) {
+		local[i]   = ComposeTransform(Vec3(dist(rng), dist(rng), dist(rng)) * 0.01f, Quat::FromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), dist(rng)), Vec3(1.0f));
+		parents[i] = i == 0 ? -1 : static_cast<std::int32_t>(rng() % i);
+	}
+
+	std::printf("compose hierarchy of %zu nodes\n", NODE_COUNT);
+	scalar = Measure("scalar", [&] {
+		for (std::size_t i = 0; i < NODE_COUNT; i++) world[i] = parents[i] < 0 ? local[i] : ScalarMultiply(world[parents[i]], local[i]);
+		g_sink = world[NODE_COUNT - 1][3].x;
+	});
+	batch = Measure("MathBatch::ComposeHierarchy", [&] {
+		MathBatch::ComposeHierarchy(local, parents, world);
+		g_sink = world[NODE_COUNT - 1][3].x;
+	});
+	std::printf("  speedup %.2fx\n", scalar / batch);
+
+	Frustum                   frustum = Frustum::FromMatrix(Mat4::Perspective(1.2f, 16.0f / 9.0f, 0.1f, 150.0f) * Mat4::LookAt(Vec3(0.0f, 0.0f, 120.0f), Vec3(0.0f), Vec3(0.0f, 1.0f, 0.0f)));
+	std::vector<std::uint8_t> visible(POINT_COUNT);
+
+	std::printf("cull %zu bounding spheres\n", POINT_COUNT);
+	scalar = Measure("scalar AoS", [&] {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i < POINT_COUNT; i++) n += visible[i] = frustum.IntersectsSphere(points[i], radii[i]) ? 1 : 0;
+		g_sink = static_cast<float>(n);
+	});
+	batch = Measure("MathBatch::CullSpheres", [&] {
+		g_sink = static_cast<float>(MathBatch::CullSpheres(frustum, { x, y, z }, radii, visible));
+	});
+	std::printf("  speedup %.2fx\n", scalar / batch);
+
+	std::printf("cull %zu bounding boxes\n", POINT_COUNT);
+	scalar = Measure("scalar AoS", [&] {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i < POINT_COUNT; i++) n += visible[i] = frustum.IntersectsAABB(points[i], Vec3(radii[i])) ? 1 : 0;
+		g_sink = static_cast<float>(n);
+	});
+	batch = Measure("MathBatch::CullAABBs", [&] {
+		g_sink = static_cast<float>(MathBatch::CullAABBs(frustum, { x, y, z }, { radii, radii, radii }, visible));
+	});
+	std::printf("  speedup %.2fx\n", scalar / batch);
+
+	return 0;
+}
@@ -14,7 +14,15 @@
 
 namespace Junia {
 
-#ifdef BUILD_JUNIA
+#if !defined(_WIN32)
+
+/**
+ * @def   JUNIA_SYMBOL
+ * @brief declare a symbol to be visible outside of the shared library
+ */
+#define JUNIA_SYMBOL __attribute__((visibility("default")))
+
+#elif defined(BUILD_JUNIA)
 
 /**
  * @def   JUNIA_SYMBOL
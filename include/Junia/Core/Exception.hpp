@@ -87,7 +87,7 @@ public:
 	 * @returns a c string containing the error message with the lifetime of the
 	 *          exception
 	 */
-	[[nodiscard]] virtual const char* what() const override final;
+	[[nodiscard]] virtual const char* what() const noexcept override final;
 
 	/**
 	 * @brief   check if the code position was provided when throwing
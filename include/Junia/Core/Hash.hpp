@@ -0,0 +1,52 @@
+/*******************************************************************************
+ *
+ * @file      Hash.hpp
+ * @brief     Contains hash functions that are stable across platforms and can
+ *            therefore be stored in files
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_CORE_HASH
+#define __HEADER_JUNIA_CORE_HASH
+
+#include <cstdint>
+#include <string_view>
+
+namespace Junia {
+
+/**
+ * @brief        compute the 64 bit FNV-1a hash of a byte sequence
+ * @param   data the bytes to hash
+ * @param   seed the initial hash value. Different seeds produce independent
+ *               hash functions.
+ * @returns      the hash value
+ */
+constexpr std::uint64_t HashFNV1a64(std::string_view data, std::uint64_t seed = 0xCBF29CE484222325ull) noexcept {
+	std::uint64_t hash = seed;
+	for (char c : data) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 0x100000001B3ull;
+	}
+	return hash;
+}
+
+/**
+ * @brief         scramble the bits of a 64 bit value (the SplitMix64 finalizer)
+ * @param   value the value to scramble
+ * @returns       the scrambled value. Every input bit affects every output bit.
+ */
+constexpr std::uint64_t HashMix64(std::uint64_t value) noexcept {
+	value ^= value >> 30;
+	value *= 0xBF58476D1CE4E5B9ull;
+	value ^= value >> 27;
+	value *= 0x94D049BB133111EBull;
+	value ^= value >> 31;
+	return value;
+}
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_CORE_HASH)
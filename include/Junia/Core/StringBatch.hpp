@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * @file      StringBatch.hpp
+ * @brief     Contains the class definition for many strings stored in one
+ *            contiguous buffer
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_CORE_STRINGBATCH
+#define __HEADER_JUNIA_CORE_STRINGBATCH
+
+#include "Core.hpp"
+
+#include "Strings.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace Junia {
+
+/**
+ *
+ * @class StringBatch
+ * @brief an immutable list of strings that share a single allocation
+ *
+ * @note  the allocation holds an array of count + 1 offsets followed by the
+ *        characters of all strings. Every string is terminated with a '\0'
+ *        that is not part of its view. String i starts at offset i and ends
+ *        one character before offset i + 1.
+ *
+ */
+template <typename TChar>
+class StringBatch final {
+public:
+	/**
+	 * @brief StringBatch object constructor. Creates an empty batch.
+	 */
+	StringBatch() noexcept
+		: count(0), offsets(&emptyOffset), data(nullptr) { }
+
+	/**
+	 * @brief       StringBatch move constructor
+	 * @param other the batch to move. It is empty afterwards.
+	 */
+	StringBatch(StringBatch&& other) noexcept
+		: StringBatch() {
+		*this = std::move(other);
+	}
+
+	/**
+	 * @brief         StringBatch move assignment operator
+	 * @param   other the batch to move. It is empty afterwards.
+	 * @returns       this batch
+	 */
+	StringBatch& operator=(StringBatch&& other) noexcept {
+		if (this == &other) return *this;
+		this->memory  = std::move(other.memory);
+		this->count   = std::exchange(other.count, 0);
+		this->offsets = other.offsets == &other.emptyOffset ? &this->emptyOffset : other.offsets;
+		this->data    = std::exchange(other.data, nullptr);
+		other.offsets = &other.emptyOffset;
+		return *this;
+	}
+
+	StringBatch(const StringBatch&)            = delete;
+	StringBatch& operator=(const StringBatch&) = delete;
+
+	/**
+	 * @brief   get the number of strings
+	 * @returns the number of strings in the batch
+	 */
+	[[nodiscard]] std::size_t GetSize() const noexcept {
+		return this->count;
+	}
+
+	/**
+	 * @brief   check if the batch contains no strings
+	 * @returns true if the batch is empty, false otherwise
+	 */
+	[[nodiscard]] bool IsEmpty() const noexcept {
+		return this->count == 0;
+	}
+
+	/**
+	 * @brief         get a string of the batch
+	 * @param   index the index of the string. Must be less than GetSize().
+	 * @returns       a view of the string without its terminator
+	 */
+	[[nodiscard]] std::basic_string_view<TChar> operator[](std::size_t index) const noexcept {
+		return { this->data + this->offsets[index], this->offsets[index + 1] - this->offsets[index] - 1 };
+	}
+
+	/**
+	 * @brief         get a string of the batch for APIs that expect a
+	 *                terminated string
+	 * @param   index the index of the string. Must be less than GetSize().
+	 * @returns       a pointer to the '\0' terminated string
+	 */
+	[[nodiscard]] const TChar* GetCString(std::size_t index) const noexcept {
+		return this->data + this->offsets[index];
+	}
+
+	/**
+	 * @brief   get the characters of all strings
+	 * @returns the contiguous buffer including the terminators
+	 */
+	[[nodiscard]] std::span<const TChar> GetData() const noexcept {
+		return { this->data, this->offsets[this->count] };
+	}
+
+	/**
+	 * @brief   get the offsets of the strings in the buffer
+	 * @returns GetSize() + 1 offsets. The last one is the size of the buffer.
+	 */
+	[[nodiscard]] std::span<const std::size_t> GetOffsets() const noexcept {
+		return { this->offsets, this->count + 1 };
+	}
+
+private:
+	friend class StringConvert;
+
+	/**
+	 * @brief        StringBatch object constructor. The offsets and
+	 *               characters are left uninitialized.
+	 * @param count  the number of strings
+	 * @param length the number of characters including the terminators
+	 */
+	StringBatch(std::size_t count, std::size_t length)
+		: memory(new std::byte[(count + 1) * sizeof(std::size_t) + length * sizeof(TChar)]), count(count) {
+		static_assert(alignof(TChar) <= alignof(std::size_t));
+		this->offsets = reinterpret_cast<std::size_t*>(this->memory.get());
+		this->data    = reinterpret_cast<TChar*>(this->memory.get() + (count + 1) * sizeof(std::size_t));
+	}
+
+	std::unique_ptr<std::byte[]> memory;
+	std::size_t                  count;
+	std::size_t*                 offsets;
+	TChar*                       data;
+	std::size_t                  emptyOffset = 0;
+};
+
+using utf8_string_batch  = StringBatch<utf8_string::value_type>;  // a batch of UTF-8 encoded strings
+using utf16_string_batch = StringBatch<utf16_string::value_type>; // a batch of UTF-16 encoded strings
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_CORE_STRINGBATCH)
@@ -13,11 +13,16 @@
 
 #include "Core.hpp"
 
+#include "../Exceptions/ExBatchStringEncoding.hpp"
 #include "../Exceptions/ExUnicodeStringEncoding.hpp"
 #include "../Exceptions/ExUtf16StringEncoding.hpp"
 #include "../Exceptions/ExUtf8StringEncoding.hpp"
+#include "StringBatch.hpp"
 #include "Strings.hpp"
 
+#include <cstddef>
+#include <span>
+
 namespace Junia {
 
 /**
@@ -86,7 +91,64 @@ public:
 	 */
 	static utf8_string UTF16ToUTF8(const utf16_string& utf16);
 
+	/**
+	 * @brief               convert many UTF-8 encoded strings to UTF-16 at once
+	 * @param   utf8        the UTF-8 strings to convert
+	 * @param   threadCount the number of threads to split the batch across or
+	 *                      0 for one per hardware thread. Batches of less than
+	 *                      64 KiB per thread use fewer threads.
+	 * @returns             the UTF-16 strings in a single allocation. They are
+	 *                      the same as the results of UTF8ToUTF16().
+	 *
+	 * @throws ExBatchStringEncoding if a string was invalid. The exception
+	 *                               holds the index of the first invalid
+	 *                               string and chains the exception
+	 *                               UTF8ToUTF16() throws for it.
+	 */
+	static utf16_string_batch UTF8ToUTF16Batch(std::span<const utf8_string_view> utf8, std::size_t threadCount = 1);
+
+	/**
+	 * @brief               convert many UTF-8 encoded strings to UTF-16 at once
+	 * @param   utf8        the UTF-8 strings to convert
+	 * @param   threadCount the number of threads to split the batch across or
+	 *                      0 for one per hardware thread
+	 * @returns             the UTF-16 strings in a single allocation
+	 *
+	 * @throws ExBatchStringEncoding if a string was invalid
+	 */
+	static utf16_string_batch UTF8ToUTF16Batch(std::span<const utf8_string> utf8, std::size_t threadCount = 1);
+
+	/**
+	 * @brief               convert many UTF-16 encoded strings to UTF-8 at once
+	 * @param   utf16       the UTF-16 strings to convert
+	 * @param   threadCount the number of threads to split the batch across or
+	 *                      0 for one per hardware thread. Batches of less than
+	 *                      64 KiB per thread use fewer threads.
+	 * @returns             the UTF-8 strings in a single allocation. They are
+	 *                      the same as the results of UTF16ToUTF8().
+	 *
+	 * @throws ExBatchStringEncoding if a string was invalid. The exception
+	 *                               holds the index of the first invalid
+	 *                               string and chains the exception
+	 *                               UTF16ToUTF8() throws for it.
+	 */
+	static utf8_string_batch UTF16ToUTF8Batch(std::span<const utf16_string_view> utf16, std::size_t threadCount = 1);
+
+	/**
+	 * @brief               convert many UTF-16 encoded strings to UTF-8 at once
+	 * @param   utf16       the UTF-16 strings to convert
+	 * @param   threadCount the number of threads to split the batch across or
+	 *                      0 for one per hardware thread
+	 * @returns             the UTF-8 strings in a single allocation
+	 *
+	 * @throws ExBatchStringEncoding if a string was invalid
+	 */
+	static utf8_string_batch UTF16ToUTF8Batch(std::span<const utf16_string> utf16, std::size_t threadCount = 1);
+
 private:
+	template <typename TOutput, typename TInput>
+	static StringBatch<TOutput> ConvertBatch(std::span<const TInput> input, std::size_t threadCount);
+
 	StringConvert()                     = delete;
 	StringConvert(const StringConvert&) = delete;
 	~StringConvert()                    = delete;
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *
+ * @file      StringConvertCache.hpp
+ * @brief     Contains the class definition for memoizing string conversions
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_CORE_STRINGCONVERTCACHE
+#define __HEADER_JUNIA_CORE_STRINGCONVERTCACHE
+
+#include "Core.hpp"
+
+#include "../Exceptions/ExUtf8StringEncoding.hpp"
+#include "Hash.hpp"
+#include "StringConvert.hpp"
+#include "Strings.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Junia {
+
+/**
+ * @struct StringConvertCacheStatistics
+ * @brief  the counters of a StringConvertCache
+ */
+struct StringConvertCacheStatistics {
+	std::uint64_t hits       = 0;
+	std::uint64_t misses     = 0;
+	std::uint64_t evictions  = 0; // entries removed to stay within the budget
+	std::uint64_t entryCount = 0;
+	std::uint64_t bytes      = 0; // bytes charged against the budget
+	std::uint64_t budget     = 0;
+	double        hitRate    = 0; // hits / (hits + misses), 0 without lookups
+};
+
+/**
+ *
+ * @class StringConvertCache
+ * @brief an optional cache in front of StringConvert::UTF8ToUTF16() for
+ *        strings that are converted over and over, like file paths
+ *
+ * @note  the cache is split into SHARD_COUNT least recently used lists with
+ *        their own lock, so threads rarely wait for each other. A string is
+ *        assigned to a shard by the hash of its content and every shard gets
+ *        an equal part of the byte budget. The results are shared and
+ *        immutable and stay valid after they were evicted. All methods are
+ *        thread-safe.
+ *
+ */
+class JUNIA_SYMBOL StringConvertCache final {
+public:
+	static constexpr std::size_t SHARD_COUNT    = 16;
+	static constexpr std::size_t DEFAULT_BUDGET = 4 * 1024 * 1024;
+
+	/**
+	 * @brief        StringConvertCache object constructor
+	 * @param budget the maximum number of bytes the cached strings and their
+	 *               bookkeeping may use
+	 */
+	explicit StringConvertCache(std::size_t budget = DEFAULT_BUDGET);
+
+	StringConvertCache(const StringConvertCache&)            = delete;
+	StringConvertCache& operator=(const StringConvertCache&) = delete;
+
+	/**
+	 * @brief        convert a string from UTF-8 to UTF-16 or return the cached
+	 *               result of an earlier conversion
+	 * @param   utf8 the string in UTF-8
+	 * @returns      the same string as StringConvert::UTF8ToUTF16()
+	 *
+	 * @throws ExUtf8StringEncoding if the UTF-8 string was invalid. Failed
+	 *                              conversions are not cached.
+	 */
+	[[nodiscard]] std::shared_ptr<const utf16_string> UTF8ToUTF16(utf8_string_view utf8);
+
+	/**
+	 * @brief remove all entries. The counters are kept.
+	 */
+	void Clear() noexcept;
+
+	/**
+	 * @brief set the hit, miss and eviction counters to 0
+	 */
+	void ResetStatistics() noexcept;
+
+	/**
+	 * @brief   get the counters and the memory usage
+	 * @returns the statistics of all shards
+	 */
+	[[nodiscard]] StringConvertCacheStatistics GetStatistics() const noexcept;
+
+	/**
+	 * @brief   get the byte budget
+	 * @returns the budget passed to the constructor
+	 */
+	[[nodiscard]] std::size_t GetBudget() const noexcept;
+
+private:
+	struct Entry {
+		std::uint64_t                       hash;
+		utf8_string                         key;
+		std::shared_ptr<const utf16_string> value;
+		std::size_t                         size;
+	};
+
+	struct Shard {
+		mutable std::mutex                                                 mutex;
+		std::list<Entry>                                                   entries; // most recently used first
+		std::unordered_multimap<std::uint64_t, std::list<Entry>::iterator> index;
+		std::size_t                                                        bytes = 0;
+	};
+
+	static std::size_t GetEntrySize(const utf8_string& key, const utf16_string& value) noexcept;
+	Shard&             GetShard(std::uint64_t hash) noexcept;
+	void               Insert(Shard& shard, Entry&& entry);
+
+	std::size_t                    budget;
+	std::size_t                    shardBudget;
+	std::array<Shard, SHARD_COUNT> shards;
+	std::atomic<std::uint64_t>     hits;
+	std::atomic<std::uint64_t>     misses;
+	std::atomic<std::uint64_t>     evictions;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_CORE_STRINGCONVERTCACHE)
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ *
+ * @file      StringTranscode.hpp
+ * @brief     Contains the class definition for transcoding text between UTF-8
+ *            and legacy or byte order dependent encodings
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_CORE_STRINGTRANSCODE
+#define __HEADER_JUNIA_CORE_STRINGTRANSCODE
+
+#include "Core.hpp"
+
+#include "../Exceptions/ExInvalidArgument.hpp"
+#include "../Exceptions/ExLatin1StringEncoding.hpp"
+#include "../Exceptions/ExUtf16ByteStringEncoding.hpp"
+#include "../Exceptions/ExUtf32StringEncoding.hpp"
+#include "../Exceptions/ExUtf8StringEncoding.hpp"
+#include "../Exceptions/ExWindows1252StringEncoding.hpp"
+#include "Strings.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Junia {
+
+/**
+ * @enum  TextEncoding
+ * @brief the encodings StringTranscode converts from and to UTF-8
+ */
+enum class TextEncoding : std::uint8_t {
+	UTF8,
+	UTF16LE,
+	UTF16BE,
+	UTF32LE,
+	UTF32BE,
+	Latin1,     // ISO-8859-1
+	Windows1252
+};
+
+/**
+ * @struct TextEncodingDetection
+ * @brief  the result of StringTranscode::DetectEncoding()
+ */
+struct TextEncodingDetection {
+	TextEncoding encoding;
+	std::size_t  bomSize;  // 0 if the data has no byte order mark
+};
+
+/**
+ *
+ * @class StringTranscode
+ * @brief static class to transcode text between UTF-8 and other encodings
+ *
+ * @note  UTF-8, UTF-16 and UTF-32 are validated strictly: overlong
+ *        sequences, surrogate codepoints and codepoints above U+10FFFF are
+ *        rejected. ASCII runs are converted 16 bytes at a time with SSE2 and
+ *        the single byte encodings are decoded with lookup tables.
+ *
+ */
+class JUNIA_SYMBOL StringTranscode final {
+public:
+	/**
+	 * @brief            detect the encoding of text by its byte order mark
+	 * @param   data     the text
+	 * @param   fallback the encoding to assume if there is no byte order mark
+	 * @returns          the encoding and the size of the byte order mark
+	 */
+	static TextEncodingDetection DetectEncoding(std::span<const std::byte> data, TextEncoding fallback = TextEncoding::UTF8) noexcept;
+
+	/**
+	 * @brief            get the byte order mark of an encoding
+	 * @param   encoding the encoding
+	 * @returns          the byte order mark. Empty for Latin-1 and
+	 *                   Windows-1252.
+	 */
+	static std::span<const std::byte> GetBOM(TextEncoding encoding) noexcept;
+
+	/**
+	 * @brief            decode text to UTF-8. A byte order mark is not
+	 *                   removed.
+	 * @param   data     the encoded text
+	 * @param   encoding the encoding of the text
+	 * @returns          the text in UTF-8
+	 *
+	 * @throws ExUtf8StringEncoding        if the UTF-8 text was invalid
+	 * @throws ExUtf16ByteStringEncoding   if the UTF-16 text was invalid
+	 * @throws ExUtf32StringEncoding       if the UTF-32 text was invalid
+	 * @throws ExWindows1252StringEncoding if the text contained a byte that
+	 *                                     is undefined in Windows-1252
+	 */
+	static utf8_string Decode(std::span<const std::byte> data, TextEncoding encoding);
+
+	/**
+	 * @brief            decode text in the encoding of its byte order mark to
+	 *                   UTF-8 and remove the byte order mark
+	 * @param   data     the encoded text
+	 * @param   fallback the encoding to assume if there is no byte order mark
+	 * @returns          the text in UTF-8
+	 *
+	 * @throws ExStringEncoding subclasses as Decode()
+	 */
+	static utf8_string DecodeText(std::span<const std::byte> data, TextEncoding fallback = TextEncoding::UTF8);
+
+	/**
+	 * @brief            encode UTF-8 text
+	 * @param   utf8     the text in UTF-8
+	 * @param   encoding the encoding to convert to
+	 * @param   bom      true to start the result with the byte order mark of
+	 *                   the encoding
+	 * @returns          the encoded text
+	 *
+	 * @throws ExUtf8StringEncoding        if the UTF-8 text was invalid
+	 * @throws ExLatin1StringEncoding      if a codepoint has no Latin-1
+	 *                                     representation
+	 * @throws ExWindows1252StringEncoding if a codepoint has no Windows-1252
+	 *                                     representation
+	 */
+	static std::vector<std::byte> Encode(utf8_string_view utf8, TextEncoding encoding, bool bom = false);
+
+private:
+	StringTranscode()                       = delete;
+	StringTranscode(const StringTranscode&) = delete;
+	~StringTranscode()                      = delete;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_CORE_STRINGTRANSCODE)
@@ -12,15 +12,18 @@
 
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace Junia {
 
 using ucodepoint_t       = char32_t;                                                                                            // a unicode codepoint
 using utf8_string        = std::string;                                                                                         // a string of UTF-8 encoded characters
+using utf8_string_view   = std::string_view;                                                                                    // a view of UTF-8 encoded characters
 using utf8_stringstream  = std::stringstream;                                                                                   // a string stream for UTF-8 encoded strings
 using u_string           = std::basic_string<ucodepoint_t, std::char_traits<ucodepoint_t>, std::allocator<ucodepoint_t>>;       // a string of unicode codepoints
 using u_stringstream     = std::basic_stringstream<ucodepoint_t, std::char_traits<ucodepoint_t>, std::allocator<ucodepoint_t>>; // a string stream of unicode codepoints
 using utf16_string       = std::basic_string<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t>>;                      // a string of UTF-16 encoded characters
+using utf16_string_view  = std::basic_string_view<wchar_t, std::char_traits<wchar_t>>;                                          // a view of UTF-16 encoded characters
 using utf16_stringstream = std::basic_stringstream<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t>>;                // a string stream for UTF-16 encoded strings
 
 } // namespace Junia
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ *
+ * @file      ExAssetPack.hpp
+ * @brief     Contains the ExAssetPack exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXASSETPACK
+#define __HEADER_JUNIA_EXCEPTIONS_EXASSETPACK
+
+#include "../Core/Exception.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExAssetPack : public Exception {
+public:
+	/**
+	 * @brief ExAssetPack object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param path     the path of the asset or pack that caused the exception
+	 */
+	ExAssetPack(const utf8_string& msg, std::exception_ptr previous, CodePos location, const utf8_string& path) noexcept;
+
+	/**
+	 * @brief   get the path of the asset or pack that caused the exception
+	 * @returns the path of the asset or pack that caused the exception
+	 */
+	const utf8_string& GetPath() const noexcept;
+
+protected:
+	utf8_string path;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXASSETPACK)
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ *
+ * @file      ExBatchStringEncoding.hpp
+ * @brief     Contains the ExBatchStringEncoding exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXBATCHSTRINGENCODING
+#define __HEADER_JUNIA_EXCEPTIONS_EXBATCHSTRINGENCODING
+
+#include "ExStringEncoding.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExBatchStringEncoding : public ExStringEncoding {
+public:
+	/**
+	 * @brief ExBatchStringEncoding object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous the exception of the single string conversion that
+	 *                 failed or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param element  the index of the string in the batch that caused the
+	 *                 exception
+	 * @param index    the index of the character in that string that caused
+	 *                 the exception
+	 */
+	ExBatchStringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t element, std::size_t index) noexcept;
+
+	/**
+	 * @brief   get the index of the string in the batch that caused the
+	 *          exception
+	 * @returns the index of the string that caused the exception
+	 */
+	std::size_t GetElement() const noexcept;
+
+protected:
+	std::size_t element;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXBATCHSTRINGENCODING)
@@ -0,0 +1,45 @@
+/*******************************************************************************
+ *
+ * @file      ExCompression.hpp
+ * @brief     Contains the ExCompression exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXCOMPRESSION
+#define __HEADER_JUNIA_EXCEPTIONS_EXCOMPRESSION
+
+#include "../Core/Exception.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExCompression : public Exception {
+public:
+	/**
+	 * @brief ExCompression object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param offset   the offset in the compressed data at which the error was
+	 *                 detected
+	 */
+	ExCompression(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t offset) noexcept;
+
+	/**
+	 * @brief   get the offset in the compressed data at which the error was
+	 *          detected
+	 * @returns the offset in the compressed data at which the error was
+	 *          detected
+	 */
+	std::size_t GetOffset() const noexcept;
+
+protected:
+	std::size_t offset;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXCOMPRESSION)
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * @file      ExDeviceMemory.hpp
+ * @brief     Contains the ExDeviceMemory exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXDEVICEMEMORY
+#define __HEADER_JUNIA_EXCEPTIONS_EXDEVICEMEMORY
+
+#include "../Core/Exception.hpp"
+
+#include <cstdint>
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExDeviceMemory : public Exception {
+public:
+	/**
+	 * @brief ExDeviceMemory object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param size     the size of the requested allocation in bytes
+	 */
+	ExDeviceMemory(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::uint64_t size) noexcept;
+
+	/**
+	 * @brief   get the size of the requested allocation
+	 * @returns the size of the requested allocation in bytes
+	 */
+	std::uint64_t GetSize() const noexcept;
+
+protected:
+	std::uint64_t size;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXDEVICEMEMORY)
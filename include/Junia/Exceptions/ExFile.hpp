@@ -0,0 +1,42 @@
+/*******************************************************************************
+ *
+ * @file      ExFile.hpp
+ * @brief     Contains the ExFile exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXFILE
+#define __HEADER_JUNIA_EXCEPTIONS_EXFILE
+
+#include "../Core/Exception.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExFile : public Exception {
+public:
+	/**
+	 * @brief ExFile object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param path     the path of the file that caused the exception
+	 */
+	ExFile(const utf8_string& msg, std::exception_ptr previous, CodePos location, const utf8_string& path) noexcept;
+
+	/**
+	 * @brief   get the path of the file that caused the exception
+	 * @returns the path of the file that caused the exception
+	 */
+	const utf8_string& GetPath() const noexcept;
+
+protected:
+	utf8_string path;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXFILE)
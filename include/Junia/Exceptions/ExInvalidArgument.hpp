@@ -0,0 +1,42 @@
+/*******************************************************************************
+ *
+ * @file      ExInvalidArgument.hpp
+ * @brief     Contains the ExInvalidArgument exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXINVALIDARGUMENT
+#define __HEADER_JUNIA_EXCEPTIONS_EXINVALIDARGUMENT
+
+#include "../Core/Exception.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExInvalidArgument : public Exception {
+public:
+	/**
+	 * @brief ExInvalidArgument object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param argument the name of the argument that was invalid
+	 */
+	ExInvalidArgument(const utf8_string& msg, std::exception_ptr previous = nullptr, CodePos location = CodePos::NotProvided(), const utf8_string& argument = "") noexcept;
+
+	/**
+	 * @brief   get the name of the argument that was invalid
+	 * @returns the name of the argument that caused the exception
+	 */
+	const utf8_string& GetArgument() const noexcept;
+
+protected:
+	utf8_string argument;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXINVALIDARGUMENT)
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ *
+ * @file      ExLatin1StringEncoding.hpp
+ * @brief     Contains the ExLatin1StringEncoding exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXLATIN1STRINGENCODING
+#define __HEADER_JUNIA_EXCEPTIONS_EXLATIN1STRINGENCODING
+
+#include "ExStringEncoding.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExLatin1StringEncoding : public ExStringEncoding {
+public:
+	/**
+	 * @brief ExLatin1StringEncoding object constructor
+	 * @param msg       a text message explaining the exception
+	 * @param previous  an exception that led to this exception or a nullptr
+	 * @param location  the code position this exception was thrown in (see
+	 *                  JUNIA_CODEPOS)
+	 * @param index     the index of the byte that caused the exception
+	 * @param codepoint the codepoint that has no Latin-1 representation
+	 */
+	ExLatin1StringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, ucodepoint_t codepoint) noexcept;
+
+	/**
+	 * @brief   get the codepoint that has no Latin-1 representation
+	 * @returns the codepoint that caused the exception
+	 */
+	ucodepoint_t GetCodepoint() const noexcept;
+
+protected:
+	ucodepoint_t codepoint;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXLATIN1STRINGENCODING)
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * @file      ExLocalization.hpp
+ * @brief     Contains the ExLocalization exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXLOCALIZATION
+#define __HEADER_JUNIA_EXCEPTIONS_EXLOCALIZATION
+
+#include "../Core/Exception.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExLocalization : public Exception {
+public:
+	/**
+	 * @brief ExLocalization object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param key      the key or language that caused the exception or an
+	 *                 empty string
+	 */
+	ExLocalization(const utf8_string& msg, std::exception_ptr previous, CodePos location, const utf8_string& key) noexcept;
+
+	/**
+	 * @brief   get the key or language that caused the exception
+	 * @returns the key or language that caused the exception or an empty
+	 *          string
+	 */
+	const utf8_string& GetKey() const noexcept;
+
+protected:
+	utf8_string key;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXLOCALIZATION)
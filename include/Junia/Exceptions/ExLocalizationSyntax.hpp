@@ -0,0 +1,45 @@
+/*******************************************************************************
+ *
+ * @file      ExLocalizationSyntax.hpp
+ * @brief     Contains the ExLocalizationSyntax exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXLOCALIZATIONSYNTAX
+#define __HEADER_JUNIA_EXCEPTIONS_EXLOCALIZATIONSYNTAX
+
+#include "../Core/Exception.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExLocalizationSyntax : public Exception {
+public:
+	/**
+	 * @brief ExLocalizationSyntax object constructor
+	 * @param msg      a text message explaining the exception
+	 * @param previous an exception that led to this exception or a nullptr
+	 * @param location the code position this exception was thrown in (see
+	 *                 JUNIA_CODEPOS)
+	 * @param line     the line of the translation source in which the error
+	 *                 was detected (starting at 1)
+	 */
+	ExLocalizationSyntax(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t line) noexcept;
+
+	/**
+	 * @brief   get the line of the translation source in which the error was
+	 *          detected
+	 * @returns the line of the translation source in which the error was
+	 *          detected (starting at 1)
+	 */
+	std::size_t GetLine() const noexcept;
+
+protected:
+	std::size_t line;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXLOCALIZATIONSYNTAX)
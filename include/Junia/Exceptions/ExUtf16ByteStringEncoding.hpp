@@ -0,0 +1,45 @@
+/*******************************************************************************
+ *
+ * @file      ExUtf16ByteStringEncoding.hpp
+ * @brief     Contains the ExUtf16ByteStringEncoding exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXUTF16BYTESTRINGENCODING
+#define __HEADER_JUNIA_EXCEPTIONS_EXUTF16BYTESTRINGENCODING
+
+#include "ExStringEncoding.hpp"
+
+#include <bit>
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExUtf16ByteStringEncoding : public ExStringEncoding {
+public:
+	/**
+	 * @brief ExUtf16ByteStringEncoding object constructor
+	 * @param msg       a text message explaining the exception
+	 * @param previous  an exception that led to this exception or a nullptr
+	 * @param location  the code position this exception was thrown in (see
+	 *                  JUNIA_CODEPOS)
+	 * @param index     the index of the byte that caused the exception
+	 * @param byteOrder the byte order of the UTF-16 data
+	 */
+	ExUtf16ByteStringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, std::endian byteOrder) noexcept;
+
+	/**
+	 * @brief   get the byte order of the UTF-16 data
+	 * @returns the byte order of the data that caused the exception
+	 */
+	std::endian GetByteOrder() const noexcept;
+
+protected:
+	std::endian byteOrder;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXUTF16BYTESTRINGENCODING)
@@ -0,0 +1,45 @@
+/*******************************************************************************
+ *
+ * @file      ExWindows1252StringEncoding.hpp
+ * @brief     Contains the ExWindows1252StringEncoding exception class definition
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_EXCEPTIONS_EXWINDOWS1252STRINGENCODING
+#define __HEADER_JUNIA_EXCEPTIONS_EXWINDOWS1252STRINGENCODING
+
+#include "ExStringEncoding.hpp"
+
+namespace Junia {
+
+class JUNIA_SYMBOL ExWindows1252StringEncoding : public ExStringEncoding {
+public:
+	/**
+	 * @brief ExWindows1252StringEncoding object constructor
+	 * @param msg       a text message explaining the exception
+	 * @param previous  an exception that led to this exception or a nullptr
+	 * @param location  the code position this exception was thrown in (see
+	 *                  JUNIA_CODEPOS)
+	 * @param index     the index of the byte that caused the exception
+	 * @param codepoint the undefined Windows-1252 byte or the codepoint that has
+	 *                  no Windows-1252 representation
+	 */
+	ExWindows1252StringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, ucodepoint_t codepoint) noexcept;
+
+	/**
+	 * @brief   get the undefined byte or the codepoint that has no Windows-1252
+	 *          representation
+	 * @returns the byte or codepoint that caused the exception
+	 */
+	ucodepoint_t GetCodepoint() const noexcept;
+
+protected:
+	ucodepoint_t codepoint;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_EXCEPTIONS_EXWINDOWS1252STRINGENCODING)
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ *
+ * @file      DeviceMemoryAllocator.hpp
+ * @brief     Contains the class definitions for sub-allocating device memory
+ *            from large blocks
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_GRAPHICS_DEVICEMEMORYALLOCATOR
+#define __HEADER_JUNIA_GRAPHICS_DEVICEMEMORYALLOCATOR
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExDeviceMemory.hpp"
+#include "../Exceptions/ExInvalidArgument.hpp"
+#include "DeviceMemoryBackend.hpp"
+#include "TlsfAllocator.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Junia {
+
+class DeviceMemoryAllocation;
+
+/**
+ * @struct DeviceMemoryRequest
+ * @brief  describes the memory a resource needs (see VkMemoryRequirements)
+ */
+struct DeviceMemoryRequest {
+	std::uint64_t size;
+	std::uint64_t alignment      = 1;     // must be a power of two
+	std::uint32_t memoryTypeBits = ~0u;   // the memory types the resource supports
+	std::uint32_t requiredFlags  = 0;     // DeviceMemoryProperty flags the type must have
+	std::uint32_t preferredFlags = 0;     // DeviceMemoryProperty flags the type should have
+	bool          optimalImage   = false; // true for images with optimal tiling
+	bool          dedicated      = false; // true to give the resource its own device memory
+	void*         userData       = nullptr;
+};
+
+/**
+ * @struct DeviceMemoryMove
+ * @brief  an allocation that is moved by DeviceMemoryAllocator::Defragment().
+ *         The data must be copied and the resource bound to the new memory.
+ *         The allocation keeps its old memory until Defragment() returns.
+ */
+struct DeviceMemoryMove {
+	DeviceMemoryAllocation* allocation;
+	DeviceMemoryHandle      srcMemory;
+	std::uint64_t           srcOffset;
+	void*                   srcData;   // nullptr if the memory is not host visible
+	DeviceMemoryHandle      dstMemory;
+	std::uint64_t           dstOffset;
+	void*                   dstData;   // nullptr if the memory is not host visible
+	std::uint64_t           size;
+};
+
+/**
+ * @struct DeviceMemoryDefragmentation
+ * @brief  the result of DeviceMemoryAllocator::Defragment()
+ */
+struct DeviceMemoryDefragmentation {
+	std::uint32_t movedAllocations = 0;
+	std::uint64_t movedBytes       = 0;
+	std::uint32_t freedBlocks      = 0;
+	std::uint64_t freedBytes       = 0;
+};
+
+/**
+ * @struct DeviceMemoryStatistics
+ * @brief  the memory usage of a heap
+ */
+struct DeviceMemoryStatistics {
+	std::uint32_t blockCount      = 0; // device memory allocations including dedicated ones
+	std::uint64_t blockBytes      = 0;
+	std::uint32_t allocationCount = 0; // allocations handed out by the allocator
+	std::uint64_t allocationBytes = 0;
+	std::uint64_t usage           = 0; // usage reported by the backend for the whole process
+	std::uint64_t budget          = 0;
+};
+
+/**
+ *
+ * @class DeviceMemoryAllocator
+ * @brief sub-allocates device memory from large blocks per memory type
+ *
+ * @note  allocations are placed in blocks with a TlsfAllocator. Large or
+ *        dedicated requests get their own device memory. Host visible blocks
+ *        stay mapped while they exist. If bufferImageGranularity is larger
+ *        than 1, linear and optimal resources are kept in separate blocks.
+ *        All methods are thread-safe.
+ *
+ */
+class JUNIA_SYMBOL DeviceMemoryAllocator final {
+public:
+	static constexpr std::uint64_t DEFAULT_BLOCK_SIZE = 64ull * 1024 * 1024;
+
+	/**
+	 * @brief           DeviceMemoryAllocator object constructor
+	 * @param backend   the backend to allocate device memory from. Must
+	 *                  outlive the allocator.
+	 * @param blockSize the preferred size of a block or 0 for the default.
+	 *                  The default is 64 MiB, or 1/8 of the heap for heaps of
+	 *                  up to 1 GiB.
+	 */
+	explicit DeviceMemoryAllocator(DeviceMemoryBackend& backend, std::uint64_t blockSize = 0);
+
+	/**
+	 * @brief DeviceMemoryAllocator object destructor. Frees all device memory,
+	 *        even if allocations were not freed.
+	 */
+	~DeviceMemoryAllocator();
+
+	DeviceMemoryAllocator(const DeviceMemoryAllocator&)            = delete;
+	DeviceMemoryAllocator& operator=(const DeviceMemoryAllocator&) = delete;
+
+	/**
+	 * @brief           allocate memory for a resource
+	 * @param   request the requirements of the resource
+	 * @returns         the allocation. Must be freed with Free().
+	 *
+	 * @throws ExInvalidArgument if the size is 0 or the alignment is not a
+	 *                           power of two
+	 * @throws ExDeviceMemory if no memory type fits the request or all fitting
+	 *                        memory types are out of memory or budget
+	 */
+	[[nodiscard]] DeviceMemoryAllocation* Allocate(const DeviceMemoryRequest& request);
+
+	/**
+	 * @brief            free an allocation. If Defragment() is moving the
+	 *                   allocation, the memory is released when it returns.
+	 * @param allocation the allocation or a nullptr
+	 */
+	void Free(DeviceMemoryAllocation* allocation) noexcept;
+
+	/**
+	 * @brief         move allocations out of sparsely used blocks into fuller
+	 *                ones and free the blocks that become empty
+	 * @param   move  called for every moved allocation. Must copy the data and
+	 *                rebind the resource. The allocator is not locked, so it
+	 *                may allocate and free memory, for example for staging,
+	 *                but must not call Defragment().
+	 * @returns       the number of moved allocations and freed blocks
+	 *
+	 * @note   the moves are planned while the allocator is locked and applied
+	 *         after all callbacks returned. If move throws, that allocation and
+	 *         the ones after it stay where they were and the exception is
+	 *         passed on. Concurrent calls to Defragment() run one after
+	 *         another.
+	 */
+	DeviceMemoryDefragmentation Defragment(const std::function<void(const DeviceMemoryMove&)>& move);
+
+	/**
+	 * @brief   get the memory usage per heap
+	 * @returns the statistics. The index is the heap index.
+	 */
+	[[nodiscard]] std::vector<DeviceMemoryStatistics> GetStatistics() const;
+
+	/**
+	 * @brief   get the backend of the allocator
+	 * @returns the backend
+	 */
+	[[nodiscard]] DeviceMemoryBackend& GetBackend() const noexcept;
+
+private:
+	friend class DeviceMemoryAllocation;
+
+	struct Block {
+		DeviceMemoryHandle                   memory;
+		std::uint32_t                        memoryType;
+		std::size_t                          pool;
+		std::byte*                           mappedData;
+		TlsfAllocator                        placement;
+		std::vector<DeviceMemoryAllocation*> allocations;
+		std::size_t                          pendingMoves = 0; // allocations Defragment() moves into this block
+	};
+
+	struct PlannedMove {
+		DeviceMemoryAllocation*   allocation;
+		Block*                    target;
+		TlsfAllocator::Allocation placed;
+		std::byte*                mappedData;
+	};
+
+	struct Pool {
+		std::vector<std::unique_ptr<Block>> blocks;
+	};
+
+	static void             Link(std::vector<DeviceMemoryAllocation*>& list, DeviceMemoryAllocation* allocation) noexcept;
+	static void             Unlink(std::vector<DeviceMemoryAllocation*>& list, DeviceMemoryAllocation* allocation) noexcept;
+	static void             ReserveLink(std::vector<DeviceMemoryAllocation*>& list, std::size_t pending = 0);
+	DeviceMemoryAllocation* AllocateFromType(std::uint32_t memoryType, const DeviceMemoryRequest& request);
+	DeviceMemoryAllocation* AllocateDedicated(std::uint32_t memoryType, const DeviceMemoryRequest& request);
+	DeviceMemoryAllocation* AllocateFromBlock(Block& block, const DeviceMemoryRequest& request);
+	Block&                  CreateBlock(std::size_t pool, std::uint32_t memoryType, std::uint64_t size, std::uint64_t minSize);
+	void                    DestroyBlock(Block& block) noexcept;
+	std::uint64_t           GetAvailableBudget(std::uint32_t memoryType) const noexcept;
+	DeviceMemoryHandle      AllocateMemory(std::uint32_t memoryType, std::uint64_t size, std::byte*& mappedData);
+	void                    FreeMemory(DeviceMemoryHandle memory, std::uint32_t memoryType, std::uint64_t size, bool mapped) noexcept;
+
+	DeviceMemoryBackend&                 backend;
+	std::vector<DeviceMemoryType>        types;
+	std::vector<std::uint64_t>           blockSizes;
+	bool                                 separateImages;
+	mutable std::mutex                   mutex;
+	std::mutex                           defragmentMutex;
+	std::vector<Pool>                    pools;
+	std::vector<DeviceMemoryAllocation*> dedicated;
+	std::vector<DeviceMemoryStatistics>  statistics;
+};
+
+/**
+ *
+ * @class DeviceMemoryAllocation
+ * @brief a range of device memory handed out by the DeviceMemoryAllocator
+ *
+ */
+class JUNIA_SYMBOL DeviceMemoryAllocation final {
+public:
+	DeviceMemoryAllocation(const DeviceMemoryAllocation&)            = delete;
+	DeviceMemoryAllocation& operator=(const DeviceMemoryAllocation&) = delete;
+
+	/**
+	 * @brief   get the device memory the allocation is placed in
+	 * @returns the handle of the device memory
+	 */
+	[[nodiscard]] DeviceMemoryHandle GetMemory() const noexcept;
+
+	/**
+	 * @brief   get the offset of the allocation in its device memory
+	 * @returns the offset in bytes
+	 */
+	[[nodiscard]] std::uint64_t GetOffset() const noexcept;
+
+	/**
+	 * @brief   get the size of the allocation
+	 * @returns the requested size in bytes
+	 */
+	[[nodiscard]] std::uint64_t GetSize() const noexcept;
+
+	/**
+	 * @brief   get the memory type of the allocation
+	 * @returns the index of the memory type
+	 */
+	[[nodiscard]] std::uint32_t GetMemoryType() const noexcept;
+
+	/**
+	 * @brief   get a pointer to the allocation for host visible memory types
+	 * @returns the pointer or a nullptr if the memory is not host visible
+	 */
+	[[nodiscard]] void* GetMappedData() const noexcept;
+
+	/**
+	 * @brief   check if the allocation has its own device memory
+	 * @returns true if the allocation is dedicated, false otherwise
+	 */
+	[[nodiscard]] bool IsDedicated() const noexcept;
+
+	/**
+	 * @brief   get the user data of the allocation
+	 * @returns the user data of the request or the last SetUserData() call
+	 */
+	[[nodiscard]] void* GetUserData() const noexcept;
+
+	/**
+	 * @brief          set the user data of the allocation
+	 * @param userData the new user data
+	 */
+	void SetUserData(void* userData) noexcept;
+
+private:
+	friend class DeviceMemoryAllocator;
+
+	DeviceMemoryAllocation() = default;
+
+	DeviceMemoryHandle            memory     = 0;
+	std::uint64_t                 offset     = 0;
+	std::uint64_t                 size       = 0;
+	std::uint64_t                 alignment  = 1;
+	std::uint32_t                 memoryType = 0;
+	std::byte*                    mappedData = nullptr;
+	void*                         userData   = nullptr;
+	DeviceMemoryAllocator::Block* block      = nullptr; // nullptr if dedicated
+	std::uint32_t                 node       = TlsfAllocator::INVALID_NODE;
+	std::size_t                   index      = 0;       // index in the allocations of the block or the dedicated allocations
+	bool                          moving     = false;   // planned to be moved by Defragment()
+	bool                          freed      = false;   // freed while moving, Defragment() releases it
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_GRAPHICS_DEVICEMEMORYALLOCATOR)
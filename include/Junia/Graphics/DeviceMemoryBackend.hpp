@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * @file      DeviceMemoryBackend.hpp
+ * @brief     Contains the interface definition for allocating device memory
+ *            from a graphics driver
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_GRAPHICS_DEVICEMEMORYBACKEND
+#define __HEADER_JUNIA_GRAPHICS_DEVICEMEMORYBACKEND
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExDeviceMemory.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace Junia {
+
+/**
+ * @brief an opaque handle of a device memory allocation (e.g. a
+ *        VkDeviceMemory). 0 is never a valid handle.
+ */
+using DeviceMemoryHandle = std::uint64_t;
+
+/**
+ * @struct DeviceMemoryProperty
+ * @brief  the property flags of a memory type. The values are the same as the
+ *         ones of VkMemoryPropertyFlagBits.
+ */
+struct DeviceMemoryProperty {
+	static constexpr std::uint32_t DEVICE_LOCAL  = 0x1;
+	static constexpr std::uint32_t HOST_VISIBLE  = 0x2;
+	static constexpr std::uint32_t HOST_COHERENT = 0x4;
+	static constexpr std::uint32_t HOST_CACHED   = 0x8;
+};
+
+/**
+ * @struct DeviceMemoryType
+ * @brief  a memory type of the device
+ */
+struct DeviceMemoryType {
+	std::uint32_t flags;     // DeviceMemoryProperty flags
+	std::uint32_t heapIndex;
+};
+
+/**
+ * @struct DeviceMemoryHeap
+ * @brief  a memory heap of the device
+ */
+struct DeviceMemoryHeap {
+	std::uint64_t size;
+	bool          deviceLocal;
+};
+
+/**
+ * @struct DeviceMemoryBudget
+ * @brief  the memory of a heap that is in use and available to the process
+ */
+struct DeviceMemoryBudget {
+	std::uint64_t usage;  // bytes allocated by the process
+	std::uint64_t budget; // bytes the process can allocate without degrading performance
+};
+
+/**
+ *
+ * @class DeviceMemoryBackend
+ * @brief the interface between the DeviceMemoryAllocator and the driver
+ *
+ * @note  implementations must be thread-safe
+ *
+ */
+class JUNIA_SYMBOL DeviceMemoryBackend {
+public:
+	virtual ~DeviceMemoryBackend() = default;
+
+	/**
+	 * @brief   get the memory types of the device
+	 * @returns the memory types. The index of a type is its memory type index.
+	 */
+	[[nodiscard]] virtual std::span<const DeviceMemoryType> GetMemoryTypes() const noexcept = 0;
+
+	/**
+	 * @brief   get the memory heaps of the device
+	 * @returns the memory heaps
+	 */
+	[[nodiscard]] virtual std::span<const DeviceMemoryHeap> GetMemoryHeaps() const noexcept = 0;
+
+	/**
+	 * @brief   get the granularity at which linear and optimal resources must
+	 *          be separated in the same allocation (bufferImageGranularity)
+	 * @returns the granularity in bytes
+	 */
+	[[nodiscard]] virtual std::uint64_t GetBufferImageGranularity() const noexcept = 0;
+
+	/**
+	 * @brief        get the current memory budget of a heap
+	 * @param   heap the index of the heap
+	 * @returns      the usage and budget of the heap
+	 */
+	[[nodiscard]] virtual DeviceMemoryBudget GetBudget(std::uint32_t heap) const noexcept = 0;
+
+	/**
+	 * @brief              allocate device memory
+	 * @param   memoryType the index of the memory type
+	 * @param   size       the size of the allocation in bytes
+	 * @returns            the handle of the allocation
+	 *
+	 * @throws ExDeviceMemory if the device is out of memory or the allocation
+	 *                        count limit is reached
+	 */
+	[[nodiscard]] virtual DeviceMemoryHandle Allocate(std::uint32_t memoryType, std::uint64_t size) = 0;
+
+	/**
+	 * @brief        free device memory. The memory must not be mapped.
+	 * @param memory the handle of the allocation
+	 */
+	virtual void Free(DeviceMemoryHandle memory) noexcept = 0;
+
+	/**
+	 * @brief          map a whole allocation of a host visible memory type
+	 * @param   memory the handle of the allocation
+	 * @returns        a pointer to the start of the allocation
+	 *
+	 * @throws ExDeviceMemory if the memory could not be mapped
+	 */
+	[[nodiscard]] virtual void* Map(DeviceMemoryHandle memory) = 0;
+
+	/**
+	 * @brief        unmap an allocation
+	 * @param memory the handle of the mapped allocation
+	 */
+	virtual void Unmap(DeviceMemoryHandle memory) noexcept = 0;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_GRAPHICS_DEVICEMEMORYBACKEND)
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * @file      DeviceMemoryRingBuffer.hpp
+ * @brief     Contains the class definition for linear and ring allocation of
+ *            per-frame upload memory
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_GRAPHICS_DEVICEMEMORYRINGBUFFER
+#define __HEADER_JUNIA_GRAPHICS_DEVICEMEMORYRINGBUFFER
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExDeviceMemory.hpp"
+#include "../Exceptions/ExInvalidArgument.hpp"
+#include "DeviceMemoryAllocator.hpp"
+
+#include <cstdint>
+#include <deque>
+
+namespace Junia {
+
+/**
+ * @struct DeviceMemorySlice
+ * @brief  a range of a DeviceMemoryRingBuffer
+ */
+struct DeviceMemorySlice {
+	DeviceMemoryHandle memory;
+	std::uint64_t      offset; // offset in the device memory
+	void*              data;   // pointer to the mapped range
+};
+
+/**
+ *
+ * @class DeviceMemoryRingBuffer
+ * @brief hands out per-frame upload memory from one persistently mapped host
+ *        visible allocation by bumping an offset
+ *
+ * @note  used as a ring buffer, each frame is closed with EndFrame() and its
+ *        memory is reused after ReleaseFrame() once the GPU finished the
+ *        frame. Used as a linear allocator, Reset() frees everything at once.
+ *        The ring buffer is not thread-safe.
+ *
+ */
+class JUNIA_SYMBOL DeviceMemoryRingBuffer final {
+public:
+	/**
+	 * @brief                DeviceMemoryRingBuffer object constructor
+	 * @param allocator      the allocator to allocate the buffer memory from.
+	 *                       Must outlive the ring buffer.
+	 * @param size           the size of the buffer in bytes
+	 * @param memoryTypeBits the memory types the buffer resource supports
+	 * @param preferredFlags DeviceMemoryProperty flags the memory should have,
+	 *                       e.g. DEVICE_LOCAL to write to device memory
+	 *                       directly where it is host visible
+	 *
+	 * @throws ExDeviceMemory if the memory could not be allocated
+	 */
+	DeviceMemoryRingBuffer(DeviceMemoryAllocator& allocator, std::uint64_t size, std::uint32_t memoryTypeBits = ~0u, std::uint32_t preferredFlags = 0);
+
+	/**
+	 * @brief DeviceMemoryRingBuffer object destructor
+	 */
+	~DeviceMemoryRingBuffer();
+
+	DeviceMemoryRingBuffer(const DeviceMemoryRingBuffer&)            = delete;
+	DeviceMemoryRingBuffer& operator=(const DeviceMemoryRingBuffer&) = delete;
+
+	/**
+	 * @brief             allocate memory for the current frame
+	 * @param   size      the size in bytes
+	 * @param   alignment the alignment of the offset. Must be a power of two.
+	 * @returns           the allocated range
+	 *
+	 * @throws ExInvalidArgument if the size is 0 or the alignment is not a
+	 *                           power of two
+	 * @throws ExDeviceMemory if the buffer has no room left until older frames
+	 *                        are released
+	 */
+	[[nodiscard]] DeviceMemorySlice Allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+	/**
+	 * @brief close the current frame. Its memory stays in use until
+	 *        ReleaseFrame() is called for it.
+	 */
+	void EndFrame();
+
+	/**
+	 * @brief   release the memory of the oldest closed frame
+	 * @returns true if a frame was released, false if there is no closed frame
+	 */
+	bool ReleaseFrame() noexcept;
+
+	/**
+	 * @brief release all frames including the current one
+	 */
+	void Reset() noexcept;
+
+	/**
+	 * @brief   get the allocation of the buffer to bind a buffer resource to
+	 * @returns the allocation
+	 */
+	[[nodiscard]] const DeviceMemoryAllocation& GetAllocation() const noexcept;
+
+	/**
+	 * @brief   get the size of the buffer
+	 * @returns the size in bytes
+	 */
+	[[nodiscard]] std::uint64_t GetSize() const noexcept;
+
+	/**
+	 * @brief   get the number of bytes in use including alignment padding
+	 * @returns the used size in bytes
+	 */
+	[[nodiscard]] std::uint64_t GetUsedSize() const noexcept;
+
+private:
+	struct Frame {
+		std::uint64_t end;
+		std::uint64_t size;
+	};
+
+	DeviceMemoryAllocator&  allocator;
+	DeviceMemoryAllocation* allocation;
+	std::byte*              data;
+	std::uint64_t           size;
+	std::uint64_t           head;
+	std::uint64_t           tail;
+	std::uint64_t           used;
+	std::uint64_t           frameSize;
+	std::deque<Frame>       frames;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_GRAPHICS_DEVICEMEMORYRINGBUFFER)
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * @file      FakeDeviceMemoryBackend.hpp
+ * @brief     Contains the class definition for the in-process device memory
+ *            backend used to test the DeviceMemoryAllocator without a GPU
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_GRAPHICS_FAKEDEVICEMEMORYBACKEND
+#define __HEADER_JUNIA_GRAPHICS_FAKEDEVICEMEMORYBACKEND
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExDeviceMemory.hpp"
+#include "DeviceMemoryBackend.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Junia {
+
+/**
+ *
+ * @class FakeDeviceMemoryBackend
+ * @brief a device memory backend that simulates a device in process memory
+ *
+ * @note  device memory is only backed by host memory once it is mapped, so
+ *        large heaps can be simulated. The backend enforces heap sizes and
+ *        the allocation count limit, can inject allocation failures and
+ *        counts API misuse (freeing unknown or mapped memory, unmapping
+ *        memory that is not mapped).
+ *
+ */
+class JUNIA_SYMBOL FakeDeviceMemoryBackend final : public DeviceMemoryBackend {
+public:
+	static constexpr std::uint32_t DEFAULT_MAX_ALLOCATION_COUNT = 4096; // maxMemoryAllocationCount of most drivers
+
+	/**
+	 * @brief FakeDeviceMemoryBackend object constructor. Simulates a discrete
+	 *        GPU with an 8 GiB device local heap and a 16 GiB host heap.
+	 */
+	FakeDeviceMemoryBackend();
+
+	/**
+	 * @brief                        FakeDeviceMemoryBackend object constructor
+	 * @param types                  the memory types of the simulated device
+	 * @param heaps                  the memory heaps of the simulated device
+	 * @param bufferImageGranularity the simulated bufferImageGranularity
+	 * @param maxAllocationCount     the maximum number of live allocations
+	 */
+	FakeDeviceMemoryBackend(std::vector<DeviceMemoryType> types, std::vector<DeviceMemoryHeap> heaps, std::uint64_t bufferImageGranularity = 1, std::uint32_t maxAllocationCount = DEFAULT_MAX_ALLOCATION_COUNT);
+
+	[[nodiscard]] std::span<const DeviceMemoryType> GetMemoryTypes() const noexcept override;
+	[[nodiscard]] std::span<const DeviceMemoryHeap> GetMemoryHeaps() const noexcept override;
+	[[nodiscard]] std::uint64_t                     GetBufferImageGranularity() const noexcept override;
+	[[nodiscard]] DeviceMemoryBudget                GetBudget(std::uint32_t heap) const noexcept override;
+	[[nodiscard]] DeviceMemoryHandle                Allocate(std::uint32_t memoryType, std::uint64_t size) override;
+	void                                            Free(DeviceMemoryHandle memory) noexcept override;
+	[[nodiscard]] void*                             Map(DeviceMemoryHandle memory) override;
+	void                                            Unmap(DeviceMemoryHandle memory) noexcept override;
+
+	/**
+	 * @brief        simulate a budget that is smaller than the heap
+	 * @param heap   the index of the heap
+	 * @param budget the budget in bytes. Allocations beyond the heap size
+	 *               still fail.
+	 */
+	void SetBudget(std::uint32_t heap, std::uint64_t budget) noexcept;
+
+	/**
+	 * @brief       make the next allocations fail as if the device was out of
+	 *              memory
+	 * @param count the number of allocations that fail
+	 */
+	void FailNextAllocations(std::uint32_t count) noexcept;
+
+	/**
+	 * @brief   get the number of live allocations
+	 * @returns the number of allocations that were not freed yet
+	 */
+	[[nodiscard]] std::uint32_t GetAllocationCount() const noexcept;
+
+	/**
+	 * @brief   get the number of successful Allocate() calls
+	 * @returns the number of allocations made since construction
+	 */
+	[[nodiscard]] std::uint64_t GetTotalAllocationCount() const noexcept;
+
+	/**
+	 * @brief   get the number of invalid Free() and Unmap() calls
+	 * @returns the number of detected API misuses
+	 */
+	[[nodiscard]] std::uint64_t GetMisuseCount() const noexcept;
+
+private:
+	struct Memory {
+		std::uint32_t                memoryType;
+		std::uint64_t                size;
+		std::unique_ptr<std::byte[]> data;
+		bool                         mapped;
+	};
+
+	std::vector<DeviceMemoryType>                  types;
+	std::vector<DeviceMemoryHeap>                  heaps;
+	std::uint64_t                                  bufferImageGranularity;
+	std::uint32_t                                  maxAllocationCount;
+	mutable std::mutex                             mutex;
+	std::vector<std::uint64_t>                     heapUsage;
+	std::vector<std::uint64_t>                     heapBudgets;
+	std::unordered_map<DeviceMemoryHandle, Memory> allocations;
+	DeviceMemoryHandle                             nextHandle;
+	std::uint32_t                                  failures;
+	std::uint64_t                                  totalAllocations;
+	std::uint64_t                                  misuses;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_GRAPHICS_FAKEDEVICEMEMORYBACKEND)
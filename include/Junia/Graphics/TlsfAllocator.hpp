@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * @file      TlsfAllocator.hpp
+ * @brief     Contains the class definition for the two-level segregated fit
+ *            placement allocator
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_GRAPHICS_TLSFALLOCATOR
+#define __HEADER_JUNIA_GRAPHICS_TLSFALLOCATOR
+
+#include "../Core/Core.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Junia {
+
+/**
+ *
+ * @class TlsfAllocator
+ * @brief places allocations in a range of offsets with a two-level segregated
+ *        fit allocator. Allocation and freeing take constant time.
+ *
+ * @note  the allocator only manages offsets, so it can place allocations in
+ *        memory that is not accessible by the CPU. Free ranges are sorted
+ *        into 16 size classes per power of two and found with two bit scans.
+ *        If no class is large enough for the size plus the worst-case
+ *        alignment padding, a bounded number of smaller ranges is checked
+ *        for a fit. A request can therefore fail even though a fitting range
+ *        exists further down a free list.
+ *
+ */
+class JUNIA_SYMBOL TlsfAllocator final {
+public:
+	static constexpr std::uint32_t INVALID_NODE = 0xFFFFFFFF;
+
+	/**
+	 * @struct Allocation
+	 * @brief  a placed allocation
+	 */
+	struct Allocation {
+		std::uint64_t offset;
+		std::uint32_t node; // INVALID_NODE if the allocation failed
+	};
+
+	/**
+	 * @brief      TlsfAllocator object constructor
+	 * @param size the size of the managed range
+	 */
+	explicit TlsfAllocator(std::uint64_t size);
+
+	/**
+	 * @brief             place an allocation
+	 * @param   size      the size of the allocation. Must not be 0.
+	 * @param   alignment the alignment of the offset. Must be a power of two.
+	 * @returns           the allocation. The node is INVALID_NODE if no free
+	 *                    range large enough was found.
+	 */
+	[[nodiscard]] Allocation Allocate(std::uint64_t size, std::uint64_t alignment);
+
+	/**
+	 * @brief      free an allocation and merge it with free neighbours
+	 * @param node the node of the allocation
+	 */
+	void Free(std::uint32_t node) noexcept;
+
+	/**
+	 * @brief   get the size of the managed range
+	 * @returns the size in bytes
+	 */
+	[[nodiscard]] std::uint64_t GetSize() const noexcept;
+
+	/**
+	 * @brief   get the number of bytes that are not allocated
+	 * @returns the free size in bytes
+	 */
+	[[nodiscard]] std::uint64_t GetFreeSize() const noexcept;
+
+	/**
+	 * @brief   get the number of live allocations
+	 * @returns the number of allocations
+	 */
+	[[nodiscard]] std::uint32_t GetAllocationCount() const noexcept;
+
+	/**
+	 * @brief   check if nothing is allocated
+	 * @returns true if there are no allocations, false otherwise
+	 */
+	[[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+	static constexpr std::uint32_t SL_BITS       = 4;
+	static constexpr std::uint32_t SL_COUNT      = 1 << SL_BITS;
+	static constexpr std::uint32_t FL_COUNT      = 64 - SL_BITS + 1;
+	static constexpr std::uint32_t MAX_FIT_STEPS = 32; // size classes and ranges FindFit() looks at
+
+	struct Node {
+		std::uint64_t offset;
+		std::uint64_t size;
+		std::uint32_t prevPhysical;
+		std::uint32_t nextPhysical;
+		std::uint32_t prevFree;
+		std::uint32_t nextFree;
+		bool          free;
+	};
+
+	static void   Mapping(std::uint64_t size, std::uint32_t& fl, std::uint32_t& sl) noexcept;
+	std::uint32_t FindFree(std::uint64_t size) const noexcept;
+	std::uint32_t FindFit(std::uint64_t size, std::uint64_t alignment) const noexcept;
+	std::uint32_t CreateNode(std::uint64_t offset, std::uint64_t size) noexcept;
+	void          DestroyNode(std::uint32_t node) noexcept;
+	void          InsertFree(std::uint32_t node) noexcept;
+	void          RemoveFree(std::uint32_t node) noexcept;
+
+	std::uint64_t                                             size;
+	std::uint64_t                                             freeSize;
+	std::uint32_t                                             allocationCount;
+	std::uint64_t                                             flBitmap;
+	std::array<std::uint32_t, FL_COUNT>                       slBitmaps;
+	std::array<std::array<std::uint32_t, SL_COUNT>, FL_COUNT> freeLists;
+	std::vector<Node>                                         nodes;
+	std::vector<std::uint32_t>                                unusedNodes;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_GRAPHICS_TLSFALLOCATOR)
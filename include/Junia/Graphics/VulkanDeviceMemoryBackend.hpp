@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * @file      VulkanDeviceMemoryBackend.hpp
+ * @brief     Contains the class definition for allocating device memory with
+ *            Vulkan
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_GRAPHICS_VULKANDEVICEMEMORYBACKEND
+#define __HEADER_JUNIA_GRAPHICS_VULKANDEVICEMEMORYBACKEND
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExDeviceMemory.hpp"
+#include "DeviceMemoryBackend.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace Junia {
+
+/**
+ *
+ * @class VulkanDeviceMemoryBackend
+ * @brief allocates device memory with vkAllocateMemory
+ *
+ * @note  the budget is read from VK_EXT_memory_budget if the device extension
+ *        is enabled. Otherwise the usage is tracked by the backend and the
+ *        budget is estimated as 80% of the heap size.
+ *
+ */
+class JUNIA_SYMBOL VulkanDeviceMemoryBackend final : public DeviceMemoryBackend {
+public:
+	/**
+	 * @brief                VulkanDeviceMemoryBackend object constructor
+	 * @param physicalDevice the physical device of the logical device
+	 * @param device         the logical device to allocate memory from. Must
+	 *                       outlive the backend.
+	 * @param memoryBudget   true if VK_EXT_memory_budget is enabled on the
+	 *                       device. Requires Vulkan 1.1.
+	 */
+	VulkanDeviceMemoryBackend(VkPhysicalDevice physicalDevice, VkDevice device, bool memoryBudget = false);
+
+	[[nodiscard]] std::span<const DeviceMemoryType> GetMemoryTypes() const noexcept override;
+	[[nodiscard]] std::span<const DeviceMemoryHeap> GetMemoryHeaps() const noexcept override;
+	[[nodiscard]] std::uint64_t                     GetBufferImageGranularity() const noexcept override;
+	[[nodiscard]] DeviceMemoryBudget                GetBudget(std::uint32_t heap) const noexcept override;
+	[[nodiscard]] DeviceMemoryHandle                Allocate(std::uint32_t memoryType, std::uint64_t size) override;
+	void                                            Free(DeviceMemoryHandle memory) noexcept override;
+	[[nodiscard]] void*                             Map(DeviceMemoryHandle memory) override;
+	void                                            Unmap(DeviceMemoryHandle memory) noexcept override;
+
+	/**
+	 * @brief          get the Vulkan handle of an allocation
+	 * @param   memory the handle of the allocation
+	 * @returns        the VkDeviceMemory to bind resources to
+	 */
+	[[nodiscard]] static VkDeviceMemory ToVulkan(DeviceMemoryHandle memory) noexcept;
+
+private:
+	struct Memory {
+		std::uint32_t heap;
+		std::uint64_t size;
+	};
+
+	static DeviceMemoryHandle FromVulkan(VkDeviceMemory memory) noexcept;
+
+	VkPhysicalDevice                               physicalDevice;
+	VkDevice                                       device;
+	bool                                           memoryBudget;
+	std::uint32_t                                  maxAllocationCount;
+	std::uint64_t                                  bufferImageGranularity;
+	std::vector<DeviceMemoryType>                  types;
+	std::vector<DeviceMemoryHeap>                  heaps;
+	mutable std::mutex                             mutex;
+	std::vector<std::uint64_t>                     heapUsage;
+	std::unordered_map<DeviceMemoryHandle, Memory> allocations;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_GRAPHICS_VULKANDEVICEMEMORYBACKEND)
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * @file      AssetPack.hpp
+ * @brief     Contains the definition of the asset pack file format and the
+ *            class definition for reading asset packs
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_IO_ASSETPACK
+#define __HEADER_JUNIA_IO_ASSETPACK
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExAssetPack.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "MappedFile.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace Junia {
+
+/**
+ * @struct AssetPackHeader
+ * @brief  the header at the start of every asset pack
+ *
+ * @note   a pack is laid out as header | entry data | table of contents |
+ *         path strings. All values are little-endian.
+ */
+struct AssetPackHeader {
+	static constexpr char          MAGIC[4]       = { 'J', 'P', 'A', 'K' };
+	static constexpr std::uint32_t VERSION        = 1;
+	static constexpr std::uint64_t DATA_ALIGNMENT = 16;
+
+	char          magic[4];
+	std::uint32_t version;
+	std::uint32_t entryCount;
+	std::uint32_t reserved;
+	std::uint64_t tocOffset;   // offset of the AssetPackEntry array
+	std::uint64_t pathsOffset; // offset of the concatenated entry paths
+	std::uint64_t pathsSize;   // size of the concatenated entry paths
+	std::uint64_t fileSize;    // total size of the pack
+};
+
+/**
+ * @struct AssetPackEntry
+ * @brief  an entry of the table of contents. The entries are sorted by
+ *         (pathHash, path) so they can be binary searched.
+ */
+struct AssetPackEntry {
+	static constexpr std::uint32_t FLAG_LZ4 = 1 << 0; // the data is an LZ4 block
+
+	std::uint64_t pathHash;   // HashFNV1a64() of the normalized path
+	std::uint64_t dataOffset; // offset of the stored data in the pack
+	std::uint64_t storedSize; // size of the stored (possibly compressed) data
+	std::uint64_t size;       // size of the uncompressed data
+	std::uint32_t pathOffset; // offset of the path in the path strings
+	std::uint32_t pathLength; // length of the path in bytes
+	std::uint32_t flags;
+	std::uint32_t reserved;
+
+	/**
+	 * @brief   check if the data of the entry is compressed
+	 * @returns true if the stored data is an LZ4 block, false otherwise
+	 */
+	[[nodiscard]] constexpr bool IsCompressed() const noexcept { return (flags & FLAG_LZ4) != 0; }
+};
+
+/**
+ *
+ * @class AssetPack
+ * @brief a memory-mapped asset pack
+ *
+ */
+class JUNIA_SYMBOL AssetPack final {
+public:
+	/**
+	 * @brief      AssetPack object constructor. Maps the pack and validates its
+	 *             table of contents.
+	 * @param path the UTF-8 encoded path of the pack file
+	 *
+	 * @throws ExFile      if the file could not be mapped
+	 * @throws ExAssetPack if the file is not a valid asset pack
+	 */
+	explicit AssetPack(const utf8_string& path);
+
+	AssetPack(const AssetPack&)            = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	/**
+	 * @brief                  find an entry
+	 * @param   normalizedPath a path that was normalized with Path::Normalize()
+	 * @returns                the entry or nullptr if the pack does not contain
+	 *                         the path
+	 */
+	[[nodiscard]] const AssetPackEntry* Find(std::string_view normalizedPath) const noexcept;
+
+	/**
+	 * @brief   get all entries of the pack
+	 * @returns the table of contents
+	 */
+	[[nodiscard]] std::span<const AssetPackEntry> GetEntries() const noexcept;
+
+	/**
+	 * @brief         get the path of an entry
+	 * @param   entry an entry of this pack
+	 * @returns       a view of the normalized path
+	 */
+	[[nodiscard]] std::string_view GetPath(const AssetPackEntry& entry) const noexcept;
+
+	/**
+	 * @brief         get the stored data of an entry
+	 * @param   entry an entry of this pack
+	 * @returns       a view of the mapped (possibly compressed) data
+	 */
+	[[nodiscard]] std::span<const std::byte> GetStoredData(const AssetPackEntry& entry) const noexcept;
+
+	/**
+	 * @brief   get the mapped pack file
+	 * @returns the mapped file
+	 */
+	[[nodiscard]] const MappedFile& GetFile() const noexcept;
+
+	/**
+	 * @brief   get the path the pack was loaded from
+	 * @returns the UTF-8 encoded path of the pack file
+	 */
+	[[nodiscard]] const utf8_string& GetFilePath() const noexcept;
+
+private:
+	utf8_string                     filePath;
+	MappedFile                      file;
+	std::span<const AssetPackEntry> entries;
+	std::string_view                paths;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_IO_ASSETPACK)
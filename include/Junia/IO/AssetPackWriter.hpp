@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * @file      AssetPackWriter.hpp
+ * @brief     Contains the class definition for creating asset packs
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_IO_ASSETPACKWRITER
+#define __HEADER_JUNIA_IO_ASSETPACKWRITER
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExAssetPack.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "AssetPack.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Junia {
+
+/**
+ *
+ * @class AssetPackWriter
+ * @brief collects assets and writes them into an asset pack
+ *
+ */
+class JUNIA_SYMBOL AssetPackWriter final {
+public:
+	/**
+	 * @brief          add an asset from memory. The data is copied.
+	 * @param path     the virtual path of the asset (normalized with
+	 *                 Path::Normalize())
+	 * @param data     the contents of the asset
+	 * @param compress if the asset should be stored LZ4 compressed. The asset
+	 *                 is stored uncompressed if compression does not save
+	 *                 space.
+	 *
+	 * @throws ExUtf8StringEncoding if the path is not valid UTF-8
+	 * @throws ExInvalidArgument    if the path leaves the root directory
+	 */
+	void Add(const utf8_string& path, std::span<const std::byte> data, bool compress = false);
+
+	/**
+	 * @brief            add an asset from a file. The file is read when the
+	 *                   pack is written.
+	 * @param path       the virtual path of the asset (normalized with
+	 *                   Path::Normalize())
+	 * @param sourceFile the UTF-8 encoded path of the file to read
+	 * @param compress   if the asset should be stored LZ4 compressed. The
+	 *                   asset is stored uncompressed if compression does not
+	 *                   save space.
+	 *
+	 * @throws ExUtf8StringEncoding if the path is not valid UTF-8
+	 * @throws ExInvalidArgument    if the path leaves the root directory
+	 */
+	void AddFile(const utf8_string& path, const utf8_string& sourceFile, bool compress = false);
+
+	/**
+	 * @brief        write all added assets into a pack file
+	 * @param output the UTF-8 encoded path of the pack file to create
+	 *
+	 * @throws ExAssetPack if two assets have the same normalized path
+	 * @throws ExFile      if a source file could not be read or the pack could
+	 *                     not be written
+	 */
+	void Write(const utf8_string& output) const;
+
+private:
+	struct PendingAsset {
+		utf8_string            path;
+		utf8_string            sourceFile;
+		std::vector<std::byte> data;
+		bool                   compress;
+	};
+
+	std::vector<PendingAsset> assets;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_IO_ASSETPACKWRITER)
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ *
+ * @file      Lz4.hpp
+ * @brief     Contains the class definition for the LZ4 block codec
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_IO_LZ4
+#define __HEADER_JUNIA_IO_LZ4
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExCompression.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace Junia {
+
+/**
+ *
+ * @class Lz4
+ * @brief static class to compress and decompress data in the LZ4 block format
+ *
+ * @note  the output is compatible with LZ4_decompress_safe() of the reference
+ *        implementation. Block sizes are not stored and have to be known by
+ *        the caller.
+ *
+ */
+class JUNIA_SYMBOL Lz4 final {
+public:
+	/**
+	 * @brief        get the maximum compressed size of a block
+	 * @param   size the size of the uncompressed data in bytes
+	 * @returns      the size the output buffer of Compress() needs to have to
+	 *               always succeed
+	 */
+	[[nodiscard]] static std::size_t CompressBound(std::size_t size) noexcept;
+
+	/**
+	 * @brief       compress a block of data
+	 * @param   src the data to compress
+	 * @param   dst the buffer that receives the compressed data
+	 * @returns     the number of bytes written to dst or 0 if dst was too small
+	 */
+	static std::size_t Compress(std::span<const std::byte> src, std::span<std::byte> dst) noexcept;
+
+	/**
+	 * @brief     decompress a block of data
+	 * @param src the compressed data
+	 * @param dst the buffer that receives the decompressed data. Its size has to
+	 *            be the exact size of the uncompressed data.
+	 *
+	 * @throws ExCompression if the compressed data is malformed or does not
+	 *                       decompress to exactly dst.size() bytes
+	 */
+	static void Decompress(std::span<const std::byte> src, std::span<std::byte> dst);
+
+private:
+	Lz4()           = delete;
+	Lz4(const Lz4&) = delete;
+	~Lz4()          = delete;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_IO_LZ4)
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * @file      MappedFile.hpp
+ * @brief     Contains the class definition for read-only memory-mapped files
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_IO_MAPPEDFILE
+#define __HEADER_JUNIA_IO_MAPPEDFILE
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExFile.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace Junia {
+
+/**
+ *
+ * @class MappedFile
+ * @brief a file that is mapped read-only into the address space of the
+ *        process. The contents are loaded lazily by the operating system.
+ *
+ */
+class JUNIA_SYMBOL MappedFile final {
+public:
+	/**
+	 * @brief MappedFile object constructor (=not open)
+	 */
+	MappedFile() noexcept;
+
+	/**
+	 * @brief      MappedFile object constructor
+	 * @param path the UTF-8 encoded path of the file to map
+	 *
+	 * @throws ExFile if the file could not be opened or mapped
+	 */
+	explicit MappedFile(const utf8_string& path);
+
+	MappedFile(MappedFile&& other) noexcept;
+	MappedFile& operator=(MappedFile&& other) noexcept;
+
+	MappedFile(const MappedFile&)            = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/**
+	 * @brief MappedFile object destructor. Unmaps the file.
+	 */
+	~MappedFile();
+
+	/**
+	 * @brief   check if a file is mapped
+	 * @returns true if a file is mapped, false otherwise
+	 */
+	[[nodiscard]] bool IsOpen() const noexcept;
+
+	/**
+	 * @brief   get the contents of the file
+	 * @returns a view of the mapped bytes that is valid for the lifetime of
+	 *          this object
+	 */
+	[[nodiscard]] std::span<const std::byte> GetData() const noexcept;
+
+	/**
+	 * @brief   get the size of the file
+	 * @returns the size of the file in bytes
+	 */
+	[[nodiscard]] std::size_t GetSize() const noexcept;
+
+	/**
+	 * @brief        hint the operating system to load a range of the file into
+	 *               memory asynchronously
+	 * @param offset the offset of the range in bytes
+	 * @param size   the size of the range in bytes
+	 */
+	void Prefetch(std::size_t offset, std::size_t size) const noexcept;
+
+private:
+	void Close() noexcept;
+
+	const std::byte* data;
+	std::size_t      size;
+	bool             open;
+#ifdef _WIN32
+	void* mapping;
+#endif
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_IO_MAPPEDFILE)
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *
+ * @file      Path.hpp
+ * @brief     Contains the class definition for the virtual path helper class
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_IO_PATH
+#define __HEADER_JUNIA_IO_PATH
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExInvalidArgument.hpp"
+#include "../Exceptions/ExUtf8StringEncoding.hpp"
+
+#include <filesystem>
+
+namespace Junia {
+
+/**
+ *
+ * @class Path
+ * @brief static class to work with UTF-8 encoded virtual file paths
+ *
+ */
+class JUNIA_SYMBOL Path final {
+public:
+	/**
+	 * @brief        normalize a virtual path so it can be used as a lookup key
+	 * @param   path the UTF-8 encoded path
+	 * @returns      the path with '/' as the only separator and without empty,
+	 *               "." and ".." components or leading and trailing separators
+	 *               (e.g. "\\textures/./ui//../logo.png" -> "textures/logo.png")
+	 *
+	 * @throws ExUtf8StringEncoding if the path is not valid UTF-8
+	 * @throws ExInvalidArgument    if a ".." component leaves the root
+	 */
+	static utf8_string Normalize(const utf8_string& path);
+
+	/**
+	 * @brief        convert a UTF-8 encoded path to a native file system path
+	 * @param   path the UTF-8 encoded path
+	 * @returns      a path that can be passed to the standard library
+	 */
+	static std::filesystem::path ToNative(const utf8_string& path);
+
+	/**
+	 * @brief        convert a native file system path to a UTF-8 encoded path
+	 * @param   path the native path
+	 * @returns      the UTF-8 encoded path with '/' as the separator
+	 */
+	static utf8_string FromNative(const std::filesystem::path& path);
+
+private:
+	Path()            = delete;
+	Path(const Path&) = delete;
+	~Path()           = delete;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_IO_PATH)
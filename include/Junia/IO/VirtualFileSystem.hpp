@@ -0,0 +1,177 @@
+/*******************************************************************************
+ *
+ * @file      VirtualFileSystem.hpp
+ * @brief     Contains the class definition for the virtual file system that
+ *            serves assets from mounted asset packs
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_IO_VIRTUALFILESYSTEM
+#define __HEADER_JUNIA_IO_VIRTUALFILESYSTEM
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExAssetPack.hpp"
+#include "../Exceptions/ExCompression.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "../Exceptions/ExInvalidArgument.hpp"
+#include "../Exceptions/ExUtf8StringEncoding.hpp"
+#include "AssetPack.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Junia {
+
+/**
+ *
+ * @class AssetData
+ * @brief the contents of an asset opened through the VirtualFileSystem
+ *
+ * @note  uncompressed assets are a zero-copy view into the mapped pack and
+ *        stay valid as long as the VirtualFileSystem exists. Decompressed
+ *        assets own their buffer.
+ *
+ */
+class JUNIA_SYMBOL AssetData final {
+public:
+	AssetData() noexcept = default;
+	AssetData(std::span<const std::byte> view, std::shared_ptr<const std::vector<std::byte>> owner = nullptr) noexcept;
+
+	/**
+	 * @brief   get the contents of the asset
+	 * @returns a view of the uncompressed bytes
+	 */
+	[[nodiscard]] std::span<const std::byte> GetData() const noexcept;
+
+	/**
+	 * @brief   get the size of the asset
+	 * @returns the size of the uncompressed asset in bytes
+	 */
+	[[nodiscard]] std::size_t GetSize() const noexcept;
+
+	/**
+	 * @brief   check if the data is a view into the mapped pack
+	 * @returns true if no copy was made, false if the asset was decompressed
+	 */
+	[[nodiscard]] bool IsMapped() const noexcept;
+
+private:
+	std::span<const std::byte>                    view;
+	std::shared_ptr<const std::vector<std::byte>> owner;
+};
+
+/**
+ *
+ * @class VirtualFileSystem
+ * @brief resolves virtual paths to assets in mounted asset packs
+ *
+ * @note  Mount() may not be called concurrently with any other method. All
+ *        other methods are thread-safe.
+ *
+ */
+class JUNIA_SYMBOL VirtualFileSystem final {
+public:
+	VirtualFileSystem();
+
+	VirtualFileSystem(const VirtualFileSystem&)            = delete;
+	VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+	/**
+	 * @brief VirtualFileSystem object destructor. Stops the prefetch thread.
+	 */
+	~VirtualFileSystem();
+
+	/**
+	 * @brief          mount an asset pack. Packs that are mounted later take
+	 *                 precedence over packs that were mounted earlier.
+	 * @param packPath the UTF-8 encoded path of the pack file
+	 *
+	 * @throws ExFile      if the file could not be mapped
+	 * @throws ExAssetPack if the file is not a valid asset pack
+	 */
+	void Mount(const utf8_string& packPath);
+
+	/**
+	 * @brief        check if an asset exists
+	 * @param   path the virtual path of the asset
+	 * @returns      true if a mounted pack contains the asset, false otherwise
+	 *
+	 * @throws ExUtf8StringEncoding if the path is not valid UTF-8
+	 * @throws ExInvalidArgument    if the path leaves the root directory
+	 */
+	[[nodiscard]] bool Exists(const utf8_string& path) const;
+
+	/**
+	 * @brief        open an asset
+	 * @param   path the virtual path of the asset
+	 * @returns      the contents of the asset. Compressed assets are taken
+	 *               from the prefetch cache or decompressed synchronously.
+	 *
+	 * @throws ExAssetPack          if no mounted pack contains the asset, its
+	 *                              stored data is corrupt (the ExCompression
+	 *                              is the previous exception) or there is not
+	 *                              enough memory to decompress it
+	 * @throws ExUtf8StringEncoding if the path is not valid UTF-8
+	 * @throws ExInvalidArgument    if the path leaves the root directory
+	 */
+	[[nodiscard]] AssetData Open(const utf8_string& path);
+
+	/**
+	 * @brief      request an asset to be loaded on the background thread.
+	 *             Mapped pages are read ahead and compressed assets are
+	 *             decompressed into a cache that the next Open() consumes.
+	 * @param path the virtual path of the asset
+	 *
+	 * @throws ExAssetPack          if no mounted pack contains the asset
+	 * @throws ExUtf8StringEncoding if the path is not valid UTF-8
+	 * @throws ExInvalidArgument    if the path leaves the root directory
+	 */
+	void Prefetch(const utf8_string& path);
+
+	/**
+	 * @brief block until all requested prefetches are finished
+	 */
+	void WaitForPrefetch();
+
+	/**
+	 * @brief discard all decompressed assets that were prefetched but not
+	 *        opened yet
+	 */
+	void ClearPrefetchCache();
+
+private:
+	struct Location {
+		const AssetPack*      pack;
+		const AssetPackEntry* entry;
+	};
+
+	[[nodiscard]] Location Find(const utf8_string& path) const;
+	void                   PrefetchThread();
+
+	std::vector<std::unique_ptr<AssetPack>> packs;
+
+	std::mutex                                                                               mutex;
+	std::condition_variable                                                                  queueChanged;
+	std::condition_variable                                                                  entryFinished;
+	std::deque<Location>                                                                     queue;
+	const AssetPackEntry*                                                                    inFlight;
+	std::unordered_map<const AssetPackEntry*, std::shared_ptr<const std::vector<std::byte>>> cache;
+	bool                                                                                     stop;
+	std::thread                                                                              thread;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_IO_VIRTUALFILESYSTEM)
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ *
+ * @file      Localization.hpp
+ * @brief     Contains the class definition for looking up translated strings
+ *            in the current language
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_LOCALIZATION_LOCALIZATION
+#define __HEADER_JUNIA_LOCALIZATION_LOCALIZATION
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "../Exceptions/ExLocalization.hpp"
+#include "LocalizationTable.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Junia {
+
+/**
+ *
+ * @class Localization
+ * @brief the loaded localization tables and the current language
+ *
+ * @note  all tables stay mapped until the object is destroyed, so switching
+ *        the language only exchanges a pointer. Load() may not be called
+ *        concurrently with any other method. All other methods are
+ *        thread-safe.
+ *
+ */
+class JUNIA_SYMBOL Localization final {
+public:
+	/**
+	 * @brief Localization object constructor (=no language)
+	 */
+	Localization() noexcept;
+
+	Localization(const Localization&)            = delete;
+	Localization& operator=(const Localization&) = delete;
+
+	/**
+	 * @brief      load a compiled localization table. The first table that is
+	 *             loaded becomes the current language.
+	 * @param path the UTF-8 encoded path of the table file
+	 *
+	 * @throws ExFile         if the file could not be mapped
+	 * @throws ExLocalization if the file is not a valid localization table or
+	 *                        a table of the same language is already loaded
+	 */
+	void Load(const utf8_string& path);
+
+	/**
+	 * @brief          change the current language
+	 * @param language the language name of a loaded table
+	 *
+	 * @throws ExLocalization if no table of the language is loaded
+	 */
+	void SetLanguage(utf8_string_view language);
+
+	/**
+	 * @brief   get the current language
+	 * @returns the language name or an empty view if no table is loaded
+	 */
+	[[nodiscard]] utf8_string_view GetLanguage() const noexcept;
+
+	/**
+	 * @brief   get the languages of all loaded tables
+	 * @returns the language names in the order the tables were loaded
+	 */
+	[[nodiscard]] std::vector<utf8_string_view> GetLanguages() const;
+
+	/**
+	 * @brief       find a string in the current language
+	 * @param   key the key of the string
+	 * @returns     views into the table that are valid for the lifetime of this
+	 *              object or std::nullopt if the key does not exist
+	 */
+	[[nodiscard]] std::optional<LocalizedString> Find(utf8_string_view key) const noexcept;
+
+	/**
+	 * @brief       get a string in the current language
+	 * @param   key the key of the string
+	 * @returns     views into the table that are valid for the lifetime of this
+	 *              object
+	 *
+	 * @throws ExLocalization if the key does not exist or no table is loaded
+	 */
+	[[nodiscard]] LocalizedString Get(utf8_string_view key) const;
+
+private:
+	std::vector<std::unique_ptr<LocalizationTable>> tables;
+	std::atomic<const LocalizationTable*>           current;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_LOCALIZATION_LOCALIZATION)
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * @file      LocalizationCompiler.hpp
+ * @brief     Contains the class definition for compiling translation sources
+ *            into localization tables
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_LOCALIZATION_LOCALIZATIONCOMPILER
+#define __HEADER_JUNIA_LOCALIZATION_LOCALIZATIONCOMPILER
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "../Exceptions/ExLocalization.hpp"
+#include "../Exceptions/ExLocalizationSyntax.hpp"
+#include "../Exceptions/ExUtf8StringEncoding.hpp"
+#include "../Serialization/BinaryWriter.hpp"
+#include "LocalizationTable.hpp"
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+namespace Junia {
+
+/**
+ *
+ * @class LocalizationCompiler
+ * @brief compiles the translations of one language into a localization table
+ *
+ * @note  a translation source is a UTF-8 text file with one "key = value"
+ *        pair per line. Empty lines and lines starting with '#' are ignored.
+ *        Keys and values are trimmed. A value may be enclosed in double
+ *        quotes to keep surrounding whitespace and may contain the escape
+ *        sequences \\, \", \n, \r and \t.
+ *
+ */
+class JUNIA_SYMBOL LocalizationCompiler final {
+public:
+	/**
+	 * @brief          LocalizationCompiler object constructor
+	 * @param language the language name stored in the table
+	 */
+	explicit LocalizationCompiler(const utf8_string& language);
+
+	/**
+	 * @brief       add a translated string
+	 * @param key   the key of the string
+	 * @param value the UTF-8 encoded translation
+	 *
+	 * @throws ExLocalization       if the key is empty or was already added
+	 * @throws ExUtf8StringEncoding if the key or value is not valid UTF-8
+	 */
+	void Add(const utf8_string& key, const utf8_string& value);
+
+	/**
+	 * @brief        add all strings of a translation source
+	 * @param source the contents of the translation source
+	 *
+	 * @throws ExLocalizationSyntax if a line is malformed or not valid UTF-8
+	 * @throws ExLocalization       if a key was already added
+	 */
+	void AddSource(utf8_string_view source);
+
+	/**
+	 * @brief      add all strings of a translation source file
+	 * @param path the UTF-8 encoded path of the translation source
+	 *
+	 * @throws ExFile               if the file could not be read
+	 * @throws ExLocalizationSyntax if a line is malformed or not valid UTF-8
+	 * @throws ExLocalization       if a key was already added
+	 */
+	void AddSourceFile(const utf8_string& path);
+
+	/**
+	 * @brief   build the perfect hash index and the table
+	 * @returns the compiled table
+	 *
+	 * @throws ExLocalization  if no perfect hash could be found for the keys
+	 * @throws ExSerialization if the table exceeds 2 GiB
+	 */
+	[[nodiscard]] std::vector<std::byte> Compile() const;
+
+	/**
+	 * @brief        build the table and write it to a file
+	 * @param output the UTF-8 encoded path of the table file to write
+	 *
+	 * @throws ExLocalization  if no perfect hash could be found for the keys
+	 * @throws ExSerialization if the table exceeds 2 GiB
+	 * @throws ExFile          if the file could not be written
+	 */
+	void Compile(const utf8_string& output) const;
+
+private:
+	struct PendingString {
+		utf8_string  key;
+		utf8_string  utf8;
+		utf16_string utf16;
+	};
+
+	BinaryRef<LocalizationTableData> Build(BinaryWriter& writer) const;
+
+	utf8_string                     language;
+	std::vector<PendingString>      strings;
+	std::unordered_set<utf8_string> keys;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_LOCALIZATION_LOCALIZATIONCOMPILER)
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *
+ * @file      LocalizationTable.hpp
+ * @brief     Contains the definition of the compiled localization table format
+ *            and the class definition for reading localization tables
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_LOCALIZATION_LOCALIZATIONTABLE
+#define __HEADER_JUNIA_LOCALIZATION_LOCALIZATIONTABLE
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Hash.hpp"
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "../Exceptions/ExLocalization.hpp"
+#include "../Serialization/Binary.hpp"
+#include "../Serialization/BinaryReader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <tuple>
+
+namespace Junia {
+
+/**
+ * @struct LocalizationEntry
+ * @brief  a translated string of a compiled localization table
+ */
+struct LocalizationEntry {
+	BinaryString                           key;
+	BinaryString                           utf8;
+	BinaryVector<utf16_string::value_type> utf16; // UTF-16 code units including a terminating '\0'
+
+	static constexpr auto BinaryFields = std::make_tuple(&LocalizationEntry::key, &LocalizationEntry::utf8, &LocalizationEntry::utf16);
+};
+
+/**
+ * @struct LocalizationTableData
+ * @brief  the root of a compiled localization table, which is a binary
+ *         document (see Binary.hpp)
+ *
+ * @note   the entries are indexed by a minimal perfect hash (hash and
+ *         displace): the hash of a key selects a bucket, and the seed of the
+ *         bucket selects the slot of the key in the entry array.
+ */
+struct LocalizationTableData {
+	static constexpr std::uint32_t MAGIC   = 0x434F4C4A; // "JLOC"
+	static constexpr std::uint32_t VERSION = 1;
+
+	std::uint32_t                   magic;
+	std::uint32_t                   version;
+	std::uint32_t                   utf16UnitSize; // sizeof(utf16_string::value_type) of the compiler
+	std::uint32_t                   reserved;
+	BinaryString                    language;
+	BinaryVector<std::uint32_t>     seeds; // one seed per bucket
+	BinaryVector<LocalizationEntry> entries;
+
+	static constexpr auto BinaryFields = std::make_tuple(&LocalizationTableData::language, &LocalizationTableData::seeds, &LocalizationTableData::entries);
+
+	/**
+	 * @brief           get the bucket of a key
+	 * @param   hash    HashFNV1a64() of the key
+	 * @param   buckets the number of buckets
+	 * @returns         the index of the bucket
+	 */
+	static constexpr std::size_t GetBucket(std::uint64_t hash, std::size_t buckets) noexcept {
+		return static_cast<std::size_t>((hash >> 32) % buckets);
+	}
+
+	/**
+	 * @brief           get the slot of a key
+	 * @param   hash    HashFNV1a64() of the key
+	 * @param   seed    the seed of the bucket of the key
+	 * @param   entries the number of entries
+	 * @returns         the index of the entry
+	 */
+	static constexpr std::size_t GetSlot(std::uint64_t hash, std::uint32_t seed, std::size_t entries) noexcept {
+		return static_cast<std::size_t>(HashMix64(hash ^ (seed * 0x9E3779B97F4A7C15ull)) % entries);
+	}
+};
+
+/**
+ * @struct LocalizedString
+ * @brief  zero-copy views of a translated string
+ */
+struct LocalizedString {
+	utf8_string_view  utf8;
+	utf16_string_view utf16; // null-terminated
+};
+
+/**
+ *
+ * @class LocalizationTable
+ * @brief a compiled localization table of one language
+ *
+ */
+class JUNIA_SYMBOL LocalizationTable final {
+public:
+	/**
+	 * @brief      LocalizationTable object constructor. Maps the table and
+	 *             verifies it.
+	 * @param path the UTF-8 encoded path of the table file
+	 *
+	 * @throws ExFile         if the file could not be mapped
+	 * @throws ExLocalization if the file is not a valid localization table
+	 */
+	explicit LocalizationTable(const utf8_string& path);
+
+	/**
+	 * @brief      LocalizationTable object constructor. Verifies a table that is
+	 *             already in memory without copying it.
+	 * @param data the table. Must be aligned to BinaryHeader::MAX_ALIGNMENT and
+	 *             stay valid for the lifetime of this object.
+	 *
+	 * @throws ExLocalization if the data is not a valid localization table
+	 */
+	explicit LocalizationTable(std::span<const std::byte> data);
+
+	LocalizationTable(const LocalizationTable&)            = delete;
+	LocalizationTable& operator=(const LocalizationTable&) = delete;
+
+	/**
+	 * @brief       find a translated string
+	 * @param   key the key of the string
+	 * @returns     views into the table that are valid for the lifetime of this
+	 *              object or std::nullopt if the table does not contain the key
+	 */
+	[[nodiscard]] std::optional<LocalizedString> Find(utf8_string_view key) const noexcept;
+
+	/**
+	 * @brief       get a translated string
+	 * @param   key the key of the string
+	 * @returns     views into the table that are valid for the lifetime of this
+	 *              object
+	 *
+	 * @throws ExLocalization if the table does not contain the key
+	 */
+	[[nodiscard]] LocalizedString Get(utf8_string_view key) const;
+
+	/**
+	 * @brief   get the language of the table
+	 * @returns the language name the table was compiled with
+	 */
+	[[nodiscard]] utf8_string_view GetLanguage() const noexcept;
+
+	/**
+	 * @brief   get the number of strings in the table
+	 * @returns the number of strings
+	 */
+	[[nodiscard]] std::size_t GetSize() const noexcept;
+
+private:
+	void Validate() const;
+
+	BinaryDocument<LocalizationTableData> document;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_LOCALIZATION_LOCALIZATIONTABLE)
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * @file      Frustum.hpp
+ * @brief     Contains the definition of the view frustum type
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_FRUSTUM
+#define __HEADER_JUNIA_MATH_FRUSTUM
+
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+namespace Junia {
+
+/**
+ * @struct Frustum
+ * @brief  a view frustum described by six planes
+ *
+ * @note   every plane is stored as (nx, ny, nz, d) with a normalized normal
+ *         pointing into the frustum. A point p is inside the plane if
+ *         dot(n, p) + d >= 0.
+ */
+struct Frustum {
+	enum Plane : int { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+	Vec4 planes[Plane::Count];
+
+	/**
+	 * @brief                  create a frustum from a view-projection matrix
+	 * @param   viewProjection the matrix projection * view (clip depth [0, 1])
+	 * @returns                the frustum in the space the matrix transforms
+	 *                         from
+	 */
+	[[nodiscard]] static Frustum FromMatrix(const Mat4& viewProjection) noexcept {
+		const Mat4& m = viewProjection;
+		Vec4        row0(m[0].x, m[1].x, m[2].x, m[3].x);
+		Vec4        row1(m[0].y, m[1].y, m[2].y, m[3].y);
+		Vec4        row2(m[0].z, m[1].z, m[2].z, m[3].z);
+		Vec4        row3(m[0].w, m[1].w, m[2].w, m[3].w);
+
+		Frustum f;
+		f.planes[Left]   = row3 + row0;
+		f.planes[Right]  = row3 - row0;
+		f.planes[Bottom] = row3 + row1;
+		f.planes[Top]    = row3 - row1;
+		f.planes[Near]   = row2;
+		f.planes[Far]    = row3 - row2;
+
+		for (Vec4& plane : f.planes) {
+			float len = Length(plane.XYZ());
+			if (len > 0.0f) plane *= 1.0f / len;
+		}
+		return f;
+	}
+
+	/**
+	 * @brief          check if a sphere intersects the frustum
+	 * @param   center the center of the sphere
+	 * @param   radius the radius of the sphere
+	 * @returns        false if the sphere is completely outside, true otherwise
+	 */
+	[[nodiscard]] bool IntersectsSphere(const Vec3& center, float radius) const noexcept {
+		for (const Vec4& plane : planes)
+			if (Dot(plane.XYZ(), center) + plane.w < -radius) return false;
+		return true;
+	}
+
+	/**
+	 * @brief           check if an axis aligned bounding box intersects the
+	 *                  frustum
+	 * @param   center  the center of the box
+	 * @param   extents the half size of the box along every axis
+	 * @returns         false if the box is completely outside, true otherwise
+	 */
+	[[nodiscard]] bool IntersectsAABB(const Vec3& center, const Vec3& extents) const noexcept {
+		for (const Vec4& plane : planes) {
+			float r = extents.x * std::abs(plane.x) + extents.y * std::abs(plane.y) + extents.z * std::abs(plane.z);
+			if (Dot(plane.XYZ(), center) + plane.w < -r) return false;
+		}
+		return true;
+	}
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_MATH_FRUSTUM)
@@ -0,0 +1,21 @@
+/*******************************************************************************
+ *
+ * @file      Math.hpp
+ * @brief     Includes all headers of the math module
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_MATH
+#define __HEADER_JUNIA_MATH_MATH
+
+#include "Frustum.hpp"
+#include "MathBatch.hpp"
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#endif // !defined(__HEADER_JUNIA_MATH_MATH)
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * @file      MathBatch.hpp
+ * @brief     Contains the class definition for the batched structure-of-arrays
+ *            math kernels
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_MATHBATCH
+#define __HEADER_JUNIA_MATH_MATHBATCH
+
+#include "../Core/Core.hpp"
+
+#include "../Exceptions/ExInvalidArgument.hpp"
+#include "Frustum.hpp"
+#include "Matrix.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace Junia {
+
+/**
+ * @struct Vec3SoA
+ * @brief  a view of three-component vectors stored as one array per component
+ */
+struct Vec3SoA {
+	std::span<float> x;
+	std::span<float> y;
+	std::span<float> z;
+};
+
+/**
+ * @struct ConstVec3SoA
+ * @brief  a read-only view of three-component vectors stored as one array per
+ *         component
+ */
+struct ConstVec3SoA {
+	std::span<const float> x;
+	std::span<const float> y;
+	std::span<const float> z;
+
+	ConstVec3SoA() noexcept = default;
+	ConstVec3SoA(std::span<const float> x, std::span<const float> y, std::span<const float> z) noexcept : x(x), y(y), z(z) { }
+	ConstVec3SoA(const Vec3SoA& soa) noexcept : x(soa.x), y(soa.y), z(soa.z) { }
+};
+
+/**
+ *
+ * @class MathBatch
+ * @brief static class with math kernels that process thousands of elements
+ *        per call using the widest available SIMD instruction set (AVX, SSE2
+ *        or scalar)
+ *
+ * @note  all component arrays of one argument have to be of the same size.
+ *        Output arrays may not overlap input arrays unless they are identical.
+ *
+ */
+class JUNIA_SYMBOL MathBatch final {
+public:
+	/**
+	 * @brief        transform points (w = 1) by an affine matrix
+	 * @param matrix the transformation matrix
+	 * @param in     the points to transform
+	 * @param out    receives the transformed points. May be the same arrays as
+	 *               in.
+	 *
+	 * @throws ExInvalidArgument if the arrays differ in size
+	 */
+	static void TransformPoints(const Mat4& matrix, ConstVec3SoA in, Vec3SoA out);
+
+	/**
+	 * @brief        transform directions (w = 0) by a matrix
+	 * @param matrix the transformation matrix
+	 * @param in     the directions to transform
+	 * @param out    receives the transformed directions. May be the same
+	 *               arrays as in.
+	 *
+	 * @throws ExInvalidArgument if the arrays differ in size
+	 */
+	static void TransformVectors(const Mat4& matrix, ConstVec3SoA in, Vec3SoA out);
+
+	/**
+	 * @brief         compute the world matrices of a transform hierarchy
+	 * @param local   the matrices of every node relative to its parent
+	 * @param parents the index of the parent of every node or -1 for root
+	 *                nodes. Parents have to be stored before their children.
+	 * @param world   receives the world matrix (world[parent] * local) of every
+	 *                node
+	 *
+	 * @throws ExInvalidArgument if the arrays differ in size or a parent index
+	 *                           does not precede its child
+	 */
+	static void ComposeHierarchy(std::span<const Mat4> local, std::span<const std::int32_t> parents, std::span<Mat4> world);
+
+	/**
+	 * @brief           test bounding spheres against a frustum
+	 * @param   frustum the frustum to test against
+	 * @param   centers the centers of the spheres
+	 * @param   radii   the radii of the spheres
+	 * @param   visible receives 1 for every sphere that intersects the frustum
+	 *                  and 0 for every sphere that is completely outside
+	 * @returns         the number of visible spheres
+	 *
+	 * @throws ExInvalidArgument if the arrays differ in size
+	 */
+	static std::size_t CullSpheres(const Frustum& frustum, ConstVec3SoA centers, std::span<const float> radii, std::span<std::uint8_t> visible);
+
+	/**
+	 * @brief           test axis aligned bounding boxes against a frustum
+	 * @param   frustum the frustum to test against
+	 * @param   centers the centers of the boxes
+	 * @param   extents the half sizes of the boxes
+	 * @param   visible receives 1 for every box that intersects the frustum and
+	 *                  0 for every box that is completely outside
+	 * @returns         the number of visible boxes
+	 *
+	 * @throws ExInvalidArgument if the arrays differ in size
+	 */
+	static std::size_t CullAABBs(const Frustum& frustum, ConstVec3SoA centers, ConstVec3SoA extents, std::span<std::uint8_t> visible);
+
+private:
+	MathBatch()                 = delete;
+	MathBatch(const MathBatch&) = delete;
+	~MathBatch()                = delete;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_MATH_MATHBATCH)
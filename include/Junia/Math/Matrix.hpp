@@ -0,0 +1,247 @@
+/*******************************************************************************
+ *
+ * @file      Matrix.hpp
+ * @brief     Contains the definition of the 4x4 matrix type
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_MATRIX
+#define __HEADER_JUNIA_MATH_MATRIX
+
+#include "Vector.hpp"
+
+#include <cmath>
+
+namespace Junia {
+
+/**
+ * @struct Mat4
+ * @brief  a 4x4 float matrix stored in column-major order
+ *
+ * @note   vectors are column vectors and are transformed as M * v. Projection
+ *         matrices are right-handed and map depth to [0, 1] as Vulkan expects.
+ */
+struct alignas(16) Mat4 {
+	Vec4 columns[4];
+
+	/**
+	 * @brief Mat4 object constructor (=Identity)
+	 */
+	constexpr Mat4() noexcept
+		: columns { Vec4(1, 0, 0, 0), Vec4(0, 1, 0, 0), Vec4(0, 0, 1, 0), Vec4(0, 0, 0, 1) } { }
+
+	/**
+	 * @brief    Mat4 object constructor
+	 * @param c0 the first column
+	 * @param c1 the second column
+	 * @param c2 the third column
+	 * @param c3 the fourth column
+	 */
+	constexpr Mat4(const Vec4& c0, const Vec4& c1, const Vec4& c2, const Vec4& c3) noexcept
+		: columns { c0, c1, c2, c3 } { }
+
+	constexpr Vec4&       operator[](int column) noexcept { return columns[column]; }
+	constexpr const Vec4& operator[](int column) const noexcept { return columns[column]; }
+
+	constexpr bool operator==(const Mat4&) const noexcept = default;
+
+	/**
+	 * @brief   get the identity matrix
+	 * @returns a matrix with ones on the diagonal
+	 */
+	[[nodiscard]] static constexpr Mat4 Identity() noexcept { return Mat4(); }
+
+	/**
+	 * @brief   create a translation matrix
+	 * @param t the translation
+	 * @returns a matrix that translates points by t
+	 */
+	[[nodiscard]] static constexpr Mat4 Translation(const Vec3& t) noexcept {
+		return Mat4(Vec4(1, 0, 0, 0), Vec4(0, 1, 0, 0), Vec4(0, 0, 1, 0), Vec4(t, 1));
+	}
+
+	/**
+	 * @brief   create a scale matrix
+	 * @param s the scale factors per axis
+	 * @returns a matrix that scales along the coordinate axes
+	 */
+	[[nodiscard]] static constexpr Mat4 Scale(const Vec3& s) noexcept {
+		return Mat4(Vec4(s.x, 0, 0, 0), Vec4(0, s.y, 0, 0), Vec4(0, 0, s.z, 0), Vec4(0, 0, 0, 1));
+	}
+
+	/**
+	 * @brief          create a perspective projection matrix
+	 * @param   fovY   the vertical field of view in radians
+	 * @param   aspect the aspect ratio (width / height)
+	 * @param   zNear  the distance to the near plane
+	 * @param   zFar   the distance to the far plane
+	 * @returns        a right-handed projection matrix with depth range [0, 1]
+	 */
+	[[nodiscard]] static Mat4 Perspective(float fovY, float aspect, float zNear, float zFar) noexcept {
+		float f = 1.0f / std::tan(fovY * 0.5f);
+		return Mat4(
+			Vec4(f / aspect, 0, 0, 0),
+			Vec4(0, f, 0, 0),
+			Vec4(0, 0, zFar / (zNear - zFar), -1),
+			Vec4(0, 0, (zNear * zFar) / (zNear - zFar), 0));
+	}
+
+	/**
+	 * @brief          create an orthographic projection matrix
+	 * @param   left   the left clipping plane
+	 * @param   right  the right clipping plane
+	 * @param   bottom the bottom clipping plane
+	 * @param   top    the top clipping plane
+	 * @param   zNear  the distance to the near plane
+	 * @param   zFar   the distance to the far plane
+	 * @returns        a right-handed projection matrix with depth range [0, 1]
+	 */
+	[[nodiscard]] static constexpr Mat4 Orthographic(float left, float right, float bottom, float top, float zNear, float zFar) noexcept {
+		return Mat4(
+			Vec4(2.0f / (right - left), 0, 0, 0),
+			Vec4(0, 2.0f / (top - bottom), 0, 0),
+			Vec4(0, 0, 1.0f / (zNear - zFar), 0),
+			Vec4(-(right + left) / (right - left), -(top + bottom) / (top - bottom), zNear / (zNear - zFar), 1));
+	}
+
+	/**
+	 * @brief          create a view matrix
+	 * @param   eye    the position of the camera
+	 * @param   target the point the camera looks at
+	 * @param   up     the up direction
+	 * @returns        a right-handed view matrix
+	 */
+	[[nodiscard]] static Mat4 LookAt(const Vec3& eye, const Vec3& target, const Vec3& up) noexcept {
+		Vec3 f = Normalize(target - eye);
+		Vec3 s = Normalize(Cross(f, up));
+		Vec3 u = Cross(s, f);
+		return Mat4(
+			Vec4(s.x, u.x, -f.x, 0),
+			Vec4(s.y, u.y, -f.y, 0),
+			Vec4(s.z, u.z, -f.z, 0),
+			Vec4(-Dot(s, eye), -Dot(u, eye), Dot(f, eye), 1));
+	}
+};
+
+inline Vec4 operator*(const Mat4& m, const Vec4& v) noexcept {
+#ifdef JUNIA_MATH_SSE
+	__m128 p = v.Load();
+	__m128 r = _mm_mul_ps(m.columns[0].Load(), _mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)));
+	r        = _mm_add_ps(r, _mm_mul_ps(m.columns[1].Load(), _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1))));
+	r        = _mm_add_ps(r, _mm_mul_ps(m.columns[2].Load(), _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2))));
+	r        = _mm_add_ps(r, _mm_mul_ps(m.columns[3].Load(), _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3))));
+	Vec4 result;
+	result.Store(r);
+	return result;
+#else
+	return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z + m.columns[3] * v.w;
+#endif
+}
+
+inline Mat4 operator*(const Mat4& a, const Mat4& b) noexcept {
+	Mat4 r;
+	r.columns[0] = a * b.columns[0];
+	r.columns[1] = a * b.columns[1];
+	r.columns[2] = a * b.columns[2];
+	r.columns[3] = a * b.columns[3];
+	return r;
+}
+
+/**
+ * @brief       transform a point (w = 1) by an affine matrix
+ * @param   m   the transformation matrix
+ * @param   p   the point
+ * @returns     the transformed point without perspective division
+ */
+inline Vec3 TransformPoint(const Mat4& m, const Vec3& p) noexcept { return (m * Vec4(p, 1.0f)).XYZ(); }
+
+/**
+ * @brief       transform a direction (w = 0) by a matrix
+ * @param   m   the transformation matrix
+ * @param   v   the direction
+ * @returns     the transformed direction
+ */
+inline Vec3 TransformVector(const Mat4& m, const Vec3& v) noexcept { return (m * Vec4(v, 0.0f)).XYZ(); }
+
+/**
+ * @brief       transpose a matrix
+ * @param   m   the matrix
+ * @returns     the transposed matrix
+ */
+inline Mat4 Transpose(const Mat4& m) noexcept {
+#ifdef JUNIA_MATH_SSE
+	__m128 c0 = m.columns[0].Load();
+	__m128 c1 = m.columns[1].Load();
+	__m128 c2 = m.columns[2].Load();
+	__m128 c3 = m.columns[3].Load();
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	Mat4 r;
+	r.columns[0].Store(c0);
+	r.columns[1].Store(c1);
+	r.columns[2].Store(c2);
+	r.columns[3].Store(c3);
+	return r;
+#else
+	const Mat4& a = m;
+	return Mat4(
+		Vec4(a[0].x, a[1].x, a[2].x, a[3].x),
+		Vec4(a[0].y, a[1].y, a[2].y, a[3].y),
+		Vec4(a[0].z, a[1].z, a[2].z, a[3].z),
+		Vec4(a[0].w, a[1].w, a[2].w, a[3].w));
+#endif
+}
+
+/**
+ * @brief       invert a matrix
+ * @param   m   the matrix
+ * @returns     the inverse of the matrix or the identity matrix if m is
+ *              singular
+ */
+inline Mat4 Inverse(const Mat4& m) noexcept {
+	const float a00 = m[0].x, a01 = m[0].y, a02 = m[0].z, a03 = m[0].w;
+	const float a10 = m[1].x, a11 = m[1].y, a12 = m[1].z, a13 = m[1].w;
+	const float a20 = m[2].x, a21 = m[2].y, a22 = m[2].z, a23 = m[2].w;
+	const float a30 = m[3].x, a31 = m[3].y, a32 = m[3].z, a33 = m[3].w;
+
+	const float b00 = a00 * a11 - a01 * a10;
+	const float b01 = a00 * a12 - a02 * a10;
+	const float b02 = a00 * a13 - a03 * a10;
+	const float b03 = a01 * a12 - a02 * a11;
+	const float b04 = a01 * a13 - a03 * a11;
+	const float b05 = a02 * a13 - a03 * a12;
+	const float b06 = a20 * a31 - a21 * a30;
+	const float b07 = a20 * a32 - a22 * a30;
+	const float b08 = a20 * a33 - a23 * a30;
+	const float b09 = a21 * a32 - a22 * a31;
+	const float b10 = a21 * a33 - a23 * a31;
+	const float b11 = a22 * a33 - a23 * a32;
+
+	float det = b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06;
+	if (det == 0.0f) return Mat4::Identity();
+	float inv = 1.0f / det;
+
+	return Mat4(
+		Vec4((a11 * b11 - a12 * b10 + a13 * b09) * inv,
+			(a02 * b10 - a01 * b11 - a03 * b09) * inv,
+			(a31 * b05 - a32 * b04 + a33 * b03) * inv,
+			(a22 * b04 - a21 * b05 - a23 * b03) * inv),
+		Vec4((a12 * b08 - a10 * b11 - a13 * b07) * inv,
+			(a00 * b11 - a02 * b08 + a03 * b07) * inv,
+			(a32 * b02 - a30 * b05 - a33 * b01) * inv,
+			(a20 * b05 - a22 * b02 + a23 * b01) * inv),
+		Vec4((a10 * b10 - a11 * b08 + a13 * b06) * inv,
+			(a01 * b08 - a00 * b10 - a03 * b06) * inv,
+			(a30 * b04 - a31 * b02 + a33 * b00) * inv,
+			(a21 * b02 - a20 * b04 - a23 * b00) * inv),
+		Vec4((a11 * b07 - a10 * b09 - a12 * b06) * inv,
+			(a00 * b09 - a01 * b07 + a02 * b06) * inv,
+			(a31 * b01 - a30 * b03 - a32 * b00) * inv,
+			(a20 * b03 - a21 * b01 + a22 * b00) * inv));
+}
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_MATH_MATRIX)
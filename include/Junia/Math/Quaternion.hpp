@@ -0,0 +1,192 @@
+/*******************************************************************************
+ *
+ * @file      Quaternion.hpp
+ * @brief     Contains the definition of the quaternion type
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_QUATERNION
+#define __HEADER_JUNIA_MATH_QUATERNION
+
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+#include <cmath>
+
+namespace Junia {
+
+/**
+ * @struct Quat
+ * @brief  a quaternion (x, y, z = vector part, w = scalar part) that is used
+ *         to represent rotations
+ */
+struct alignas(16) Quat {
+	float x;
+	float y;
+	float z;
+	float w;
+
+	/**
+	 * @brief Quat object constructor (=Identity)
+	 */
+	constexpr Quat() noexcept : x(0.0f), y(0.0f), z(0.0f), w(1.0f) { }
+	constexpr Quat(float x, float y, float z, float w) noexcept : x(x), y(y), z(z), w(w) { }
+
+#ifdef JUNIA_MATH_SSE
+	__m128 Load() const noexcept { return _mm_load_ps(&x); }
+	void   Store(__m128 value) noexcept { _mm_store_ps(&x, value); }
+#endif
+
+	constexpr bool operator==(const Quat&) const noexcept = default;
+
+	/**
+	 * @brief   get the identity rotation
+	 * @returns a quaternion that does not rotate
+	 */
+	[[nodiscard]] static constexpr Quat Identity() noexcept { return Quat(); }
+
+	/**
+	 * @brief         create a rotation around an axis
+	 * @param   axis  the normalized rotation axis
+	 * @param   angle the rotation angle in radians
+	 * @returns       a unit quaternion describing the rotation
+	 */
+	[[nodiscard]] static Quat FromAxisAngle(const Vec3& axis, float angle) noexcept {
+		float s = std::sin(angle * 0.5f);
+		return Quat(axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f));
+	}
+};
+
+/**
+ * @brief       concatenate two rotations (Hamilton product)
+ * @param   a   the rotation that is applied second
+ * @param   b   the rotation that is applied first
+ * @returns     the combined rotation
+ */
+inline Quat operator*(const Quat& a, const Quat& b) noexcept {
+#ifdef JUNIA_MATH_SSE
+	__m128 qa = a.Load();
+	__m128 qb = b.Load();
+	__m128 r  = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(3, 3, 3, 3)), qb);
+	r         = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(0, 1, 2, 3))), _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f)));
+	r         = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(1, 0, 3, 2))), _mm_set_ps(-1.0f, -1.0f, 1.0f, 1.0f)));
+	r         = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(2, 3, 0, 1))), _mm_set_ps(-1.0f, 1.0f, 1.0f, -1.0f)));
+	Quat result;
+	result.Store(r);
+	return result;
+#else
+	return Quat(
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+#endif
+}
+
+constexpr float Dot(const Quat& a, const Quat& b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+constexpr Quat Conjugate(const Quat& q) noexcept { return Quat(-q.x, -q.y, -q.z, q.w); }
+
+/**
+ * @brief       normalize a quaternion
+ * @param   q   the quaternion
+ * @returns     the unit quaternion or the identity if q has a length of 0
+ */
+inline Quat Normalize(const Quat& q) noexcept {
+	float len = std::sqrt(Dot(q, q));
+	if (len <= 0.0f) return Quat::Identity();
+	float inv = 1.0f / len;
+	return Quat(q.x * inv, q.y * inv, q.z * inv, q.w * inv);
+}
+
+/**
+ * @brief       invert a quaternion
+ * @param   q   the quaternion
+ * @returns     the inverse rotation or the identity if q has a length of 0
+ */
+inline Quat Inverse(const Quat& q) noexcept {
+	float lenSq = Dot(q, q);
+	if (lenSq <= 0.0f) return Quat::Identity();
+	float inv = 1.0f / lenSq;
+	return Quat(-q.x * inv, -q.y * inv, -q.z * inv, q.w * inv);
+}
+
+/**
+ * @brief       rotate a vector by a unit quaternion
+ * @param   q   the rotation
+ * @param   v   the vector
+ * @returns     the rotated vector
+ */
+inline Vec3 Rotate(const Quat& q, const Vec3& v) noexcept {
+	Vec3 u(q.x, q.y, q.z);
+	Vec3 t = Cross(u, v) * 2.0f;
+	return v + t * q.w + Cross(u, t);
+}
+
+/**
+ * @brief       spherically interpolate between two unit quaternions along the
+ *              shortest path
+ * @param   a   the start rotation (t = 0)
+ * @param   b   the end rotation (t = 1)
+ * @param   t   the interpolation factor
+ * @returns     the interpolated unit quaternion
+ */
+inline Quat Slerp(const Quat& a, Quat b, float t) noexcept {
+	float cosTheta = Dot(a, b);
+	if (cosTheta < 0.0f) {
+		b        = Quat(-b.x, -b.y, -b.z, -b.w);
+		cosTheta = -cosTheta;
+	}
+
+	float wa = 1.0f - t;
+	float wb = t;
+	if (cosTheta < 0.9995f) {
+		float theta  = std::acos(cosTheta);
+		float invSin = 1.0f / std::sin(theta);
+		wa           = std::sin(wa * theta) * invSin;
+		wb           = std::sin(wb * theta) * invSin;
+	}
+
+	return Normalize(Quat(a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb));
+}
+
+/**
+ * @brief       convert a unit quaternion to a rotation matrix
+ * @param   q   the rotation
+ * @returns     a matrix that applies the same rotation
+ */
+inline Mat4 ToMatrix(const Quat& q) noexcept {
+	float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+	float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+	float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+	return Mat4(
+		Vec4(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f),
+		Vec4(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f),
+		Vec4(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f),
+		Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/**
+ * @brief               compose a transformation matrix from its components
+ * @param   translation the translation
+ * @param   rotation    the unit rotation quaternion
+ * @param   scale       the scale factors per axis
+ * @returns             the matrix T * R * S
+ */
+inline Mat4 ComposeTransform(const Vec3& translation, const Quat& rotation, const Vec3& scale) noexcept {
+	Mat4 m = ToMatrix(rotation);
+
+	m.columns[0] *= scale.x;
+	m.columns[1] *= scale.y;
+	m.columns[2] *= scale.z;
+	m.columns[3] = Vec4(translation, 1.0f);
+	return m;
+}
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_MATH_QUATERNION)
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * @file      Simd.hpp
+ * @brief     Contains the preprocessor definitions that select the SIMD
+ *            instruction set used by the math module
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_SIMD
+#define __HEADER_JUNIA_MATH_SIMD
+
+#if !defined(JUNIA_MATH_NO_SIMD)
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+/**
+ * @def   JUNIA_MATH_SSE
+ * @brief defined if the math module uses SSE2 instructions
+ */
+#define JUNIA_MATH_SSE
+
+#include <emmintrin.h>
+#include <xmmintrin.h>
+
+#endif
+
+#if defined(JUNIA_MATH_SSE) && defined(__AVX__)
+
+/**
+ * @def   JUNIA_MATH_AVX
+ * @brief defined if the batch kernels of the math module use AVX instructions
+ */
+#define JUNIA_MATH_AVX
+
+#include <immintrin.h>
+
+#endif
+
+#endif // !defined(JUNIA_MATH_NO_SIMD)
+
+#endif // !defined(__HEADER_JUNIA_MATH_SIMD)
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ *
+ * @file      Vector.hpp
+ * @brief     Contains the definitions of the vector types
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_MATH_VECTOR
+#define __HEADER_JUNIA_MATH_VECTOR
+
+#include "Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Junia {
+
+/**
+ * @struct Vec2
+ * @brief  a vector with two float components
+ */
+struct Vec2 {
+	float x;
+	float y;
+
+	constexpr Vec2() noexcept : x(0.0f), y(0.0f) { }
+	constexpr explicit Vec2(float s) noexcept : x(s), y(s) { }
+	constexpr Vec2(float x, float y) noexcept : x(x), y(y) { }
+
+	constexpr Vec2& operator+=(const Vec2& o) noexcept { x += o.x; y += o.y; return *this; }
+	constexpr Vec2& operator-=(const Vec2& o) noexcept { x -= o.x; y -= o.y; return *this; }
+	constexpr Vec2& operator*=(const Vec2& o) noexcept { x *= o.x; y *= o.y; return *this; }
+	constexpr Vec2& operator*=(float s) noexcept { x *= s; y *= s; return *this; }
+	constexpr Vec2& operator/=(float s) noexcept { x /= s; y /= s; return *this; }
+
+	constexpr bool operator==(const Vec2&) const noexcept = default;
+};
+
+constexpr Vec2 operator+(Vec2 a, const Vec2& b) noexcept { return a += b; }
+constexpr Vec2 operator-(Vec2 a, const Vec2& b) noexcept { return a -= b; }
+constexpr Vec2 operator*(Vec2 a, const Vec2& b) noexcept { return a *= b; }
+constexpr Vec2 operator*(Vec2 a, float s) noexcept { return a *= s; }
+constexpr Vec2 operator*(float s, Vec2 a) noexcept { return a *= s; }
+constexpr Vec2 operator/(Vec2 a, float s) noexcept { return a /= s; }
+constexpr Vec2 operator-(const Vec2& a) noexcept { return Vec2(-a.x, -a.y); }
+
+constexpr float Dot(const Vec2& a, const Vec2& b) noexcept { return a.x * b.x + a.y * b.y; }
+
+/**
+ * @struct Vec3
+ * @brief  a vector with three float components
+ *
+ * @note   Vec3 is tightly packed (12 bytes) and therefore computed with scalar
+ *         instructions. Use Vec4 or the batch kernels in MathBatch.hpp for
+ *         vectorized code paths.
+ */
+struct Vec3 {
+	float x;
+	float y;
+	float z;
+
+	constexpr Vec3() noexcept : x(0.0f), y(0.0f), z(0.0f) { }
+	constexpr explicit Vec3(float s) noexcept : x(s), y(s), z(s) { }
+	constexpr Vec3(float x, float y, float z) noexcept : x(x), y(y), z(z) { }
+
+	constexpr Vec3& operator+=(const Vec3& o) noexcept { x += o.x; y += o.y; z += o.z; return *this; }
+	constexpr Vec3& operator-=(const Vec3& o) noexcept { x -= o.x; y -= o.y; z -= o.z; return *this; }
+	constexpr Vec3& operator*=(const Vec3& o) noexcept { x *= o.x; y *= o.y; z *= o.z; return *this; }
+	constexpr Vec3& operator*=(float s) noexcept { x *= s; y *= s; z *= s; return *this; }
+	constexpr Vec3& operator/=(float s) noexcept { x /= s; y /= s; z /= s; return *this; }
+
+	constexpr bool operator==(const Vec3&) const noexcept = default;
+};
+
+constexpr Vec3 operator+(Vec3 a, const Vec3& b) noexcept { return a += b; }
+constexpr Vec3 operator-(Vec3 a, const Vec3& b) noexcept { return a -= b; }
+constexpr Vec3 operator*(Vec3 a, const Vec3& b) noexcept { return a *= b; }
+constexpr Vec3 operator*(Vec3 a, float s) noexcept { return a *= s; }
+constexpr Vec3 operator*(float s, Vec3 a) noexcept { return a *= s; }
+constexpr Vec3 operator/(Vec3 a, float s) noexcept { return a /= s; }
+constexpr Vec3 operator-(const Vec3& a) noexcept { return Vec3(-a.x, -a.y, -a.z); }
+
+constexpr float Dot(const Vec3& a, const Vec3& b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+constexpr Vec3 Cross(const Vec3& a, const Vec3& b) noexcept {
+	return Vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+/**
+ * @struct Vec4
+ * @brief  a vector with four float components that is aligned for SSE loads
+ */
+struct alignas(16) Vec4 {
+	float x;
+	float y;
+	float z;
+	float w;
+
+	constexpr Vec4() noexcept : x(0.0f), y(0.0f), z(0.0f), w(0.0f) { }
+	constexpr explicit Vec4(float s) noexcept : x(s), y(s), z(s), w(s) { }
+	constexpr Vec4(float x, float y, float z, float w) noexcept : x(x), y(y), z(z), w(w) { }
+	constexpr Vec4(const Vec3& v, float w) noexcept : x(v.x), y(v.y), z(v.z), w(w) { }
+
+#ifdef JUNIA_MATH_SSE
+	/**
+	 * @brief   load the vector into an SSE register
+	 * @returns the components in the order x, y, z, w (lowest lane first)
+	 */
+	__m128 Load() const noexcept { return _mm_load_ps(&x); }
+
+	/**
+	 * @brief       store an SSE register into the vector
+	 * @param value the components in the order x, y, z, w (lowest lane first)
+	 */
+	void Store(__m128 value) noexcept { _mm_store_ps(&x, value); }
+#endif
+
+	/**
+	 * @brief   get the first three components
+	 * @returns a Vec3 with the x, y and z components
+	 */
+	constexpr Vec3 XYZ() const noexcept { return Vec3(x, y, z); }
+
+	Vec4& operator+=(const Vec4& o) noexcept {
+#ifdef JUNIA_MATH_SSE
+		Store(_mm_add_ps(Load(), o.Load()));
+#else
+		x += o.x; y += o.y; z += o.z; w += o.w;
+#endif
+		return *this;
+	}
+
+	Vec4& operator-=(const Vec4& o) noexcept {
+#ifdef JUNIA_MATH_SSE
+		Store(_mm_sub_ps(Load(), o.Load()));
+#else
+		x -= o.x; y -= o.y; z -= o.z; w -= o.w;
+#endif
+		return *this;
+	}
+
+	Vec4& operator*=(const Vec4& o) noexcept {
+#ifdef JUNIA_MATH_SSE
+		Store(_mm_mul_ps(Load(), o.Load()));
+#else
+		x *= o.x; y *= o.y; z *= o.z; w *= o.w;
+#endif
+		return *this;
+	}
+
+	Vec4& operator*=(float s) noexcept {
+#ifdef JUNIA_MATH_SSE
+		Store(_mm_mul_ps(Load(), _mm_set1_ps(s)));
+#else
+		x *= s; y *= s; z *= s; w *= s;
+#endif
+		return *this;
+	}
+
+	Vec4& operator/=(float s) noexcept {
+#ifdef JUNIA_MATH_SSE
+		Store(_mm_div_ps(Load(), _mm_set1_ps(s)));
+#else
+		x /= s; y /= s; z /= s; w /= s;
+#endif
+		return *this;
+	}
+
+	constexpr bool operator==(const Vec4&) const noexcept = default;
+};
+
+inline Vec4 operator+(Vec4 a, const Vec4& b) noexcept { return a += b; }
+inline Vec4 operator-(Vec4 a, const Vec4& b) noexcept { return a -= b; }
+inline Vec4 operator*(Vec4 a, const Vec4& b) noexcept { return a *= b; }
+inline Vec4 operator*(Vec4 a, float s) noexcept { return a *= s; }
+inline Vec4 operator*(float s, Vec4 a) noexcept { return a *= s; }
+inline Vec4 operator/(Vec4 a, float s) noexcept { return a /= s; }
+inline Vec4 operator-(const Vec4& a) noexcept { return Vec4(-a.x, -a.y, -a.z, -a.w); }
+
+inline float Dot(const Vec4& a, const Vec4& b) noexcept {
+#ifdef JUNIA_MATH_SSE
+	__m128 m = _mm_mul_ps(a.Load(), b.Load());
+	m        = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+	m        = _mm_add_ss(m, _mm_movehl_ps(m, m));
+	return _mm_cvtss_f32(m);
+#else
+	return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif
+}
+
+inline Vec4 Min(const Vec4& a, const Vec4& b) noexcept {
+#ifdef JUNIA_MATH_SSE
+	Vec4 r;
+	r.Store(_mm_min_ps(a.Load(), b.Load()));
+	return r;
+#else
+	return Vec4(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z), std::min(a.w, b.w));
+#endif
+}
+
+inline Vec4 Max(const Vec4& a, const Vec4& b) noexcept {
+#ifdef JUNIA_MATH_SSE
+	Vec4 r;
+	r.Store(_mm_max_ps(a.Load(), b.Load()));
+	return r;
+#else
+	return Vec4(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z), std::max(a.w, b.w));
+#endif
+}
+
+constexpr Vec2 Min(const Vec2& a, const Vec2& b) noexcept { return Vec2(std::min(a.x, b.x), std::min(a.y, b.y)); }
+constexpr Vec2 Max(const Vec2& a, const Vec2& b) noexcept { return Vec2(std::max(a.x, b.x), std::max(a.y, b.y)); }
+constexpr Vec3 Min(const Vec3& a, const Vec3& b) noexcept { return Vec3(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)); }
+constexpr Vec3 Max(const Vec3& a, const Vec3& b) noexcept { return Vec3(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)); }
+
+/**
+ * @brief       get the squared length of a vector
+ * @param   v   the vector
+ * @returns     the dot product of the vector with itself
+ */
+template <typename TVec>
+inline float LengthSquared(const TVec& v) noexcept { return Dot(v, v); }
+
+/**
+ * @brief       get the length of a vector
+ * @param   v   the vector
+ * @returns     the euclidean length of the vector
+ */
+template <typename TVec>
+inline float Length(const TVec& v) noexcept { return std::sqrt(Dot(v, v)); }
+
+/**
+ * @brief       normalize a vector
+ * @param   v   the vector
+ * @returns     the vector scaled to a length of 1 or the unchanged vector if
+ *              its length is 0
+ */
+template <typename TVec>
+inline TVec Normalize(const TVec& v) noexcept {
+	float len = Length(v);
+	return len > 0.0f ? v * (1.0f / len) : v;
+}
+
+/**
+ * @brief       linearly interpolate between two vectors
+ * @param   a   the start value (t = 0)
+ * @param   b   the end value (t = 1)
+ * @param   t   the interpolation factor
+ * @returns     the interpolated vector
+ */
+template <typename TVec>
+inline TVec Lerp(const TVec& a, const TVec& b, float t) noexcept { return a + (b - a) * t; }
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_MATH_VECTOR)
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ *
+ * @file      Binary.hpp
+ * @brief     Contains the definition of the binary serialization format and
+ *            the types that are used to declare binary schemas
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_SERIALIZATION_BINARY
+#define __HEADER_JUNIA_SERIALIZATION_BINARY
+
+#include "../Core/Core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace Junia {
+
+/*
+ * A binary document is a header followed by plain structs, strings and
+ * vectors. Structs reference other data through BinaryOffset, BinaryString
+ * and BinaryVector fields, which store a signed 32 bit offset relative to the
+ * field itself (0 = null). A document can therefore be used in place wherever
+ * it is loaded or mapped, without a deserialization pass.
+ *
+ * A struct declares its schema by listing the fields that hold references,
+ * either directly or inside nested schema structs:
+ *
+ *     struct Item {
+ *         BinaryString name;
+ *         float        weight;
+ *
+ *         static constexpr auto BinaryFields = std::make_tuple(&Item::name);
+ *     };
+ *
+ * Only listed fields are verified when a document is loaded. Scalars do not
+ * need to be listed. All values are stored in the native byte order of the
+ * (little-endian) target.
+ */
+
+/**
+ * @struct BinaryHeader
+ * @brief  the header at the start of every binary document
+ */
+struct BinaryHeader {
+	static constexpr char          MAGIC[4]      = { 'J', 'B', 'I', 'N' };
+	static constexpr std::uint32_t VERSION       = 1;
+	static constexpr std::size_t   MAX_ALIGNMENT = 16; // alignment of the document start
+
+	char          magic[4];
+	std::uint32_t version;
+	std::uint32_t rootOffset; // offset of the root struct
+	std::uint32_t size;       // total size of the document
+};
+
+/**
+ * @struct BinaryOffset
+ * @brief  a reference to a T somewhere in the same document
+ */
+template <typename T>
+struct BinaryOffset {
+	std::int32_t offset = 0;
+
+	/**
+	 * @brief   check if the reference is set
+	 * @returns true if the reference is null, false otherwise
+	 */
+	[[nodiscard]] constexpr bool IsNull() const noexcept { return this->offset == 0; }
+
+	/**
+	 * @brief   resolve the reference
+	 * @returns the referenced object or nullptr if the reference is null
+	 */
+	[[nodiscard]] const T* Get() const noexcept {
+		if (this->IsNull()) return nullptr;
+		return reinterpret_cast<const T*>(reinterpret_cast<const std::byte*>(this) + this->offset);
+	}
+
+	[[nodiscard]] const T* operator->() const noexcept { return this->Get(); }
+	[[nodiscard]] const T& operator*() const noexcept { return *this->Get(); }
+};
+
+/**
+ * @struct BinaryString
+ * @brief  a reference to a length-prefixed, null-terminated UTF-8 string
+ *
+ * @note   the string data is laid out as a 32 bit length followed by the
+ *         bytes and a terminating '\0'
+ */
+struct BinaryString {
+	std::int32_t offset = 0;
+
+	/**
+	 * @brief   check if the reference is set
+	 * @returns true if the reference is null, false otherwise
+	 */
+	[[nodiscard]] constexpr bool IsNull() const noexcept { return this->offset == 0; }
+
+	/**
+	 * @brief   get the length of the string
+	 * @returns the length of the string in bytes or 0 if the reference is null
+	 */
+	[[nodiscard]] std::size_t Size() const noexcept {
+		if (this->IsNull()) return 0;
+		return *reinterpret_cast<const std::uint32_t*>(reinterpret_cast<const std::byte*>(this) + this->offset);
+	}
+
+	/**
+	 * @brief   get a view of the string without copying it
+	 * @returns the UTF-8 encoded string or an empty view if the reference is
+	 *          null
+	 */
+	[[nodiscard]] std::string_view View() const noexcept {
+		if (this->IsNull()) return {};
+		const std::byte* data = reinterpret_cast<const std::byte*>(this) + this->offset;
+		return std::string_view(reinterpret_cast<const char*>(data + sizeof(std::uint32_t)), *reinterpret_cast<const std::uint32_t*>(data));
+	}
+};
+
+/**
+ * @struct BinaryVector
+ * @brief  a reference to a contiguous array of T
+ *
+ * @note   the array is laid out as a 32 bit element count directly followed
+ *         by the elements, which are aligned to alignof(T)
+ */
+template <typename T>
+struct BinaryVector {
+	std::int32_t offset = 0;
+
+	/**
+	 * @brief   check if the reference is set
+	 * @returns true if the reference is null, false otherwise
+	 */
+	[[nodiscard]] constexpr bool IsNull() const noexcept { return this->offset == 0; }
+
+	/**
+	 * @brief   get the number of elements
+	 * @returns the number of elements or 0 if the reference is null
+	 */
+	[[nodiscard]] std::size_t Size() const noexcept {
+		if (this->IsNull()) return 0;
+		return *reinterpret_cast<const std::uint32_t*>(reinterpret_cast<const std::byte*>(this) + this->offset);
+	}
+
+	/**
+	 * @brief   get a view of the elements without copying them
+	 * @returns the elements or an empty view if the reference is null
+	 */
+	[[nodiscard]] std::span<const T> View() const noexcept {
+		if (this->IsNull()) return {};
+		const std::byte* data = reinterpret_cast<const std::byte*>(this) + this->offset;
+		return std::span<const T>(reinterpret_cast<const T*>(data + sizeof(std::uint32_t)), *reinterpret_cast<const std::uint32_t*>(data));
+	}
+
+	[[nodiscard]] const T& operator[](std::size_t index) const noexcept { return this->View()[index]; }
+	[[nodiscard]] auto     begin() const noexcept { return this->View().begin(); }
+	[[nodiscard]] auto     end() const noexcept { return this->View().end(); }
+};
+
+/**
+ * @brief checks if a type declares a binary schema
+ */
+template <typename T>
+concept BinarySchema = requires { T::BinaryFields; };
+
+/**
+ * @brief checks if a type can be stored in a binary document
+ */
+template <typename T>
+concept BinaryStorable = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T> && alignof(T) <= BinaryHeader::MAX_ALIGNMENT;
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_SERIALIZATION_BINARY)
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *
+ * @file      BinaryReader.hpp
+ * @brief     Contains the class definitions for verifying and reading binary
+ *            documents in place
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_SERIALIZATION_BINARYREADER
+#define __HEADER_JUNIA_SERIALIZATION_BINARYREADER
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "../Exceptions/ExSerialization.hpp"
+#include "../IO/MappedFile.hpp"
+#include "Binary.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace Junia {
+
+namespace BinaryDetail {
+
+template <typename T>
+struct OffsetTraits : std::false_type { };
+
+template <typename T>
+struct OffsetTraits<BinaryOffset<T>> : std::true_type {
+	using Type = T;
+};
+
+template <typename T>
+struct VectorTraits : std::false_type { };
+
+template <typename T>
+struct VectorTraits<BinaryVector<T>> : std::true_type {
+	using Type = T;
+};
+
+template <typename T>
+concept HasReferences = BinarySchema<T> || std::is_same_v<T, BinaryString> || OffsetTraits<T>::value || VectorTraits<T>::value;
+
+} // namespace BinaryDetail
+
+/**
+ *
+ * @class BinaryVerifier
+ * @brief checks that all references of a binary document stay inside the
+ *        document, so it can be read without any further checks
+ *
+ * @note  the verifier checks bounds, alignment and string termination. It
+ *        does not check that strings are valid UTF-8.
+ *
+ */
+class JUNIA_SYMBOL BinaryVerifier final {
+public:
+	static constexpr unsigned MAX_DEPTH = 64; // maximum nesting of references
+
+	/**
+	 * @brief          BinaryVerifier object constructor. Checks the header.
+	 * @param document the document. Must be aligned to
+	 *                 BinaryHeader::MAX_ALIGNMENT and may be followed by
+	 *                 unrelated data.
+	 *
+	 * @throws ExSerialization if the header is invalid
+	 */
+	explicit BinaryVerifier(std::span<const std::byte> document);
+
+	/**
+	 * @brief   verify the document with T as the type of the root struct
+	 * @returns the root struct
+	 *
+	 * @throws ExSerialization if a reference is out of bounds or misaligned, a
+	 *                         string is not terminated or the document is
+	 *                         nested too deeply
+	 */
+	template <typename T>
+	[[nodiscard]] const T& VerifyRoot() {
+		this->VerifyObject<T>(this->root, 0);
+		return *reinterpret_cast<const T*>(this->document.data() + this->root);
+	}
+
+	/**
+	 * @brief   get the document without any data that follows it
+	 * @returns the document
+	 */
+	[[nodiscard]] std::span<const std::byte> GetDocument() const noexcept;
+
+private:
+	template <typename T>
+	void VerifyObject(std::size_t offset, unsigned depth) {
+		this->CheckObject(offset, sizeof(T), alignof(T));
+		this->VerifyFields<T>(offset, depth);
+	}
+
+	template <typename T>
+	void VerifyFields(std::size_t offset, unsigned depth) {
+		if constexpr (BinarySchema<T>) {
+			const T* object = reinterpret_cast<const T*>(this->document.data() + offset);
+			std::apply([&](auto... fields) {
+				(this->VerifyField<typename MemberTraits<decltype(fields)>::Type>(offset + (reinterpret_cast<const std::byte*>(&(object->*fields)) - reinterpret_cast<const std::byte*>(object)), depth), ...);
+			}, T::BinaryFields);
+		}
+	}
+
+	template <typename M>
+	void VerifyField(std::size_t offset, unsigned depth) {
+		if constexpr (std::is_same_v<M, BinaryString>) {
+			if (const std::size_t target = this->Follow(offset, depth)) this->CheckString(target);
+		} else if constexpr (BinaryDetail::OffsetTraits<M>::value) {
+			if (const std::size_t target = this->Follow(offset, depth)) this->VerifyObject<typename BinaryDetail::OffsetTraits<M>::Type>(target, depth + 1);
+		} else if constexpr (BinaryDetail::VectorTraits<M>::value) {
+			using Element = typename BinaryDetail::VectorTraits<M>::Type;
+			if (const std::size_t target = this->Follow(offset, depth)) {
+				std::size_t count = this->CheckVector(target, sizeof(Element), alignof(Element));
+				if constexpr (BinaryDetail::HasReferences<Element>)
+					for (std::size_t i = 0; i < count; i++) this->VerifyField<Element>(target + sizeof(std::uint32_t) + i * sizeof(Element), depth + 1);
+			}
+		} else if constexpr (BinarySchema<M>) {
+			// nested struct, which is in bounds as part of its parent
+			this->VerifyFields<M>(offset, depth + 1);
+		}
+	}
+
+	template <typename P>
+	struct MemberTraits;
+
+	template <typename C, typename M>
+	struct MemberTraits<M C::*> {
+		using Type = M;
+	};
+
+	std::size_t Follow(std::size_t slot, unsigned depth);
+	void        CheckObject(std::size_t offset, std::size_t size, std::size_t alignment) const;
+	void        CheckString(std::size_t offset) const;
+	std::size_t CheckVector(std::size_t offset, std::size_t elementSize, std::size_t elementAlignment) const;
+
+	std::span<const std::byte> document;
+	std::size_t                root;
+	std::size_t                references;
+};
+
+/**
+ *
+ * @class BinaryDocument
+ * @brief a verified binary document with a root struct of type T
+ *
+ */
+template <typename T>
+class BinaryDocument final {
+public:
+	/**
+	 * @brief      BinaryDocument object constructor. Maps the file and
+	 *             verifies the document.
+	 * @param path the UTF-8 encoded path of the document file
+	 *
+	 * @throws ExFile          if the file could not be mapped
+	 * @throws ExSerialization if the file is not a valid document
+	 */
+	explicit BinaryDocument(const utf8_string& path) : file(path) {
+		this->Verify(this->file.GetData());
+	}
+
+	/**
+	 * @brief      BinaryDocument object constructor. Verifies a document that
+	 *             is already in memory without copying it.
+	 * @param data the document. Must be aligned to BinaryHeader::MAX_ALIGNMENT
+	 *             and stay valid for the lifetime of this object.
+	 *
+	 * @throws ExSerialization if the data is not a valid document
+	 */
+	explicit BinaryDocument(std::span<const std::byte> data) {
+		this->Verify(data);
+	}
+
+	BinaryDocument(BinaryDocument&&) noexcept            = default;
+	BinaryDocument& operator=(BinaryDocument&&) noexcept = default;
+
+	/**
+	 * @brief   get the root struct of the document
+	 * @returns the root struct
+	 */
+	[[nodiscard]] const T& GetRoot() const noexcept {
+		return *this->root;
+	}
+
+	[[nodiscard]] const T* operator->() const noexcept { return this->root; }
+
+	/**
+	 * @brief   get the raw document
+	 * @returns a view of the document
+	 */
+	[[nodiscard]] std::span<const std::byte> GetData() const noexcept {
+		return this->data;
+	}
+
+private:
+	void Verify(std::span<const std::byte> bytes) {
+		BinaryVerifier verifier(bytes);
+		this->root = &verifier.template VerifyRoot<T>();
+		this->data = verifier.GetDocument();
+	}
+
+	MappedFile                 file;
+	std::span<const std::byte> data;
+	const T*                   root = nullptr;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_SERIALIZATION_BINARYREADER)
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ *
+ * @file      BinaryWriter.hpp
+ * @brief     Contains the class definition for building binary documents
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#ifndef __HEADER_JUNIA_SERIALIZATION_BINARYWRITER
+#define __HEADER_JUNIA_SERIALIZATION_BINARYWRITER
+
+#include "../Core/Core.hpp"
+
+#include "../Core/Strings.hpp"
+#include "../Exceptions/ExFile.hpp"
+#include "../Exceptions/ExSerialization.hpp"
+#include "Binary.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Junia {
+
+/**
+ * @struct BinaryRef
+ * @brief  the position of a T in a document that is being built
+ */
+template <typename T>
+struct BinaryRef {
+	std::uint32_t offset;
+};
+
+/**
+ * @struct BinaryStringRef
+ * @brief  the position of string data in a document that is being built
+ */
+struct BinaryStringRef {
+	std::uint32_t offset;
+};
+
+/**
+ * @struct BinaryVectorRef
+ * @brief  the position of a vector in a document that is being built
+ */
+template <typename T>
+struct BinaryVectorRef {
+	std::uint32_t offset; // offset of the element count
+	std::uint32_t count;
+};
+
+/**
+ *
+ * @class BinaryWriter
+ * @brief builds a binary document in memory
+ *
+ * @note  objects are appended to the document in the order they are created.
+ *        References into the document are BinaryRef values instead of
+ *        pointers because the buffer may grow. References between objects are
+ *        set with Set() after both objects have been created.
+ *
+ */
+class JUNIA_SYMBOL BinaryWriter final {
+public:
+	/**
+	 * @brief BinaryWriter object constructor
+	 */
+	BinaryWriter();
+
+	/**
+	 * @brief         append a struct to the document
+	 * @param   value the initial value of the struct. All reference fields
+	 *                must be null.
+	 * @returns       the position of the struct
+	 *
+	 * @throws ExSerialization if the document exceeds 2 GiB
+	 */
+	template <BinaryStorable T>
+	BinaryRef<T> Create(const T& value = T()) {
+		std::uint32_t offset = this->Allocate(sizeof(T), alignof(T));
+		std::memcpy(this->buffer.data() + offset, &value, sizeof(T));
+		return { offset };
+	}
+
+	/**
+	 * @brief          append a string to the document
+	 * @param   string the UTF-8 encoded string
+	 * @returns        the position of the string data
+	 *
+	 * @throws ExSerialization if the document exceeds 2 GiB
+	 */
+	BinaryStringRef CreateString(std::string_view string);
+
+	/**
+	 * @brief          append a vector to the document
+	 * @param   values the initial elements. All reference fields must be null.
+	 * @returns        the position of the vector
+	 *
+	 * @throws ExSerialization if the document exceeds 2 GiB
+	 */
+	template <BinaryStorable T>
+	BinaryVectorRef<T> CreateVector(std::span<const T> values) {
+		BinaryVectorRef<T> vector = this->CreateVector<T>(values.size());
+		if (!values.empty()) std::memcpy(this->buffer.data() + vector.offset + sizeof(std::uint32_t), values.data(), values.size_bytes());
+		return vector;
+	}
+
+	/**
+	 * @brief         append a zero-initialized vector to the document. The
+	 *                elements can be accessed with At() and Get().
+	 * @param   count the number of elements
+	 * @returns       the position of the vector
+	 *
+	 * @throws ExSerialization if the document exceeds 2 GiB
+	 */
+	template <BinaryStorable T>
+	BinaryVectorRef<T> CreateVector(std::size_t count) {
+		return { this->AllocateVector(count, sizeof(T), alignof(T)), static_cast<std::uint32_t>(count) };
+	}
+
+	/**
+	 * @brief          get the position of an element of a vector
+	 * @param   vector the vector
+	 * @param   index  the index of the element. Must be less than the count.
+	 * @returns        the position of the element
+	 */
+	template <typename T>
+	[[nodiscard]] BinaryRef<T> At(BinaryVectorRef<T> vector, std::size_t index) const noexcept {
+		return { static_cast<std::uint32_t>(vector.offset + sizeof(std::uint32_t) + index * sizeof(T)) };
+	}
+
+	/**
+	 * @brief          get the position of a field of a struct
+	 * @param   object the struct
+	 * @param   field  the field
+	 * @returns        the position of the field
+	 */
+	template <typename T, typename M>
+	[[nodiscard]] BinaryRef<M> Field(BinaryRef<T> object, M T::*field) noexcept {
+		const T& value = this->Get(object);
+		return { static_cast<std::uint32_t>(object.offset + (reinterpret_cast<const std::byte*>(&(value.*field)) - reinterpret_cast<const std::byte*>(&value))) };
+	}
+
+	/**
+	 * @brief          access an object in the document
+	 * @param   object the position of the object
+	 * @returns        the object. The reference is invalidated when the next
+	 *                 object is created.
+	 *
+	 * @note           reference fields must only be modified with Set()
+	 */
+	template <typename T>
+	[[nodiscard]] T& Get(BinaryRef<T> object) noexcept {
+		return *reinterpret_cast<T*>(this->buffer.data() + object.offset);
+	}
+
+	/**
+	 * @brief        set a reference to a struct
+	 * @param slot   the reference field
+	 * @param target the referenced struct
+	 */
+	template <typename T>
+	void Set(BinaryRef<BinaryOffset<T>> slot, BinaryRef<T> target) noexcept {
+		this->Link(slot.offset, target.offset);
+	}
+
+	/**
+	 * @brief        set a reference to a string
+	 * @param slot   the string field
+	 * @param target the string data
+	 */
+	void Set(BinaryRef<BinaryString> slot, BinaryStringRef target) noexcept {
+		this->Link(slot.offset, target.offset);
+	}
+
+	/**
+	 * @brief        set a reference to a vector
+	 * @param slot   the vector field
+	 * @param target the vector
+	 */
+	template <typename T>
+	void Set(BinaryRef<BinaryVector<T>> slot, BinaryVectorRef<T> target) noexcept {
+		this->Link(slot.offset, target.offset);
+	}
+
+	/**
+	 * @brief        set a reference field of a struct
+	 * @param object the struct
+	 * @param field  the reference field
+	 * @param target the referenced object
+	 */
+	template <typename T, typename M, typename R>
+	void Set(BinaryRef<T> object, M T::*field, R target) noexcept {
+		this->Set(this->Field(object, field), target);
+	}
+
+	/**
+	 * @brief         finish the document and reset the writer
+	 * @param   root  the root struct of the document
+	 * @returns       the document
+	 */
+	template <typename T>
+	[[nodiscard]] std::vector<std::byte> Finish(BinaryRef<T> root) {
+		return this->FinishDocument(root.offset);
+	}
+
+	/**
+	 * @brief        finish the document, write it to a file and reset the
+	 *               writer
+	 * @param root   the root struct of the document
+	 * @param output the UTF-8 encoded path of the file to write
+	 *
+	 * @throws ExFile if the file could not be written
+	 */
+	template <typename T>
+	void Finish(BinaryRef<T> root, const utf8_string& output) {
+		WriteDocument(this->FinishDocument(root.offset), output);
+	}
+
+private:
+	std::uint32_t          Allocate(std::size_t size, std::size_t alignment, std::size_t alignmentOffset = 0);
+	std::uint32_t          AllocateVector(std::size_t count, std::size_t elementSize, std::size_t elementAlignment);
+	void                   Link(std::uint32_t slot, std::uint32_t target) noexcept;
+	std::vector<std::byte> FinishDocument(std::uint32_t root);
+	static void            WriteDocument(const std::vector<std::byte>& document, const utf8_string& output);
+
+	std::vector<std::byte> buffer;
+};
+
+} // namespace Junia
+
+#endif // !defined(__HEADER_JUNIA_SERIALIZATION_BINARYWRITER)
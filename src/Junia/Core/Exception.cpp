@@ -22,9 +22,9 @@ bool CodePos::IsProvided() const noexcept { return line >= 0; }
 CodePos CodePos::NotProvided() noexcept { return CodePos(); }
 
 Exception::Exception(const utf8_string& msg, std::exception_ptr previous, CodePos location) noexcept
-	: message(msg), previous(previous), location(location), std::runtime_error(nullptr) { }
+	: message(msg), previous(previous), location(location), std::runtime_error("") { }
 
-const char* Exception::what() const {
+const char* Exception::what() const noexcept {
 	return this->GetMessage().c_str();
 }
 
@@ -10,14 +10,260 @@
 
 #include <Junia/Core/StringConvert.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <bit>
+#include <limits>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Core/StringConvert.cpp";
 
 namespace Junia {
 
+namespace {
+
+constexpr std::size_t INVALID_LENGTH       = std::numeric_limits<std::size_t>::max();
+constexpr std::size_t MIN_CHARS_PER_THREAD = 64 * 1024;
+
+/**
+ * @brief a range of a batch that is converted by one thread
+ */
+struct BatchChunk {
+	std::size_t        begin;
+	std::size_t        end;
+	std::size_t        length; // output characters including terminators
+	std::exception_ptr error;
+};
+
+/**
+ * @brief         decode one UTF-8 sequence with the rules of UTF8ToUnicode()
+ * @param   utf8  the UTF-8 string
+ * @param   i     the index of the sequence. Is moved behind the sequence.
+ * @param   point the decoded codepoint
+ * @returns       false if the sequence is invalid
+ */
+bool DecodeUTF8(utf8_string_view utf8, std::size_t& i, ucodepoint_t& point) noexcept {
+	unsigned char c = static_cast<unsigned char>(utf8[i++]);
+	std::size_t   continuations;
+	if (c <= 0x7F) {
+		point = c;
+		return true;
+	} else if (c >= 0xC0 && c <= 0xDF) {
+		point         = c & 0x1F;
+		continuations = 1;
+	} else if (c >= 0xE0 && c <= 0xEF) {
+		point         = c & 0x0F;
+		continuations = 2;
+	} else if (c >= 0xF0 && c <= 0xF7) {
+		point         = c & 0x07;
+		continuations = 3;
+	} else {
+		return false;
+	}
+
+	if (utf8.size() - i < continuations) return false;
+	for (; continuations > 0; continuations--) {
+		c = static_cast<unsigned char>(utf8[i++]);
+		if (c < 0x80 || c > 0xBF) return false;
+		point = (point << 6) | (c & 0x3F);
+	}
+	return true;
+}
+
+/**
+ * @brief         decode one UTF-16 sequence with the rules of
+ *                UTF16ToUnicode()
+ * @param   utf16 the UTF-16 string
+ * @param   i     the index of the sequence. Is moved behind the sequence.
+ * @param   point the decoded codepoint
+ * @returns       false if the sequence is invalid
+ */
+bool DecodeUTF16(utf16_string_view utf16, std::size_t& i, ucodepoint_t& point) noexcept {
+	point = static_cast<ucodepoint_t>(utf16[i++]);
+	if (point < 0xD800 || point > 0xDBFF) return true;
+	if (i >= utf16.size()) return false;
+
+	ucodepoint_t low = static_cast<ucodepoint_t>(utf16[i++]);
+	if (low < 0xDC00 || low > 0xDFFF) return false;
+	point = ((point - 0xD800) << 10) + (low - 0xDC00) + 0x10000;
+	return true;
+}
+
+/**
+ * @brief         get the length of the UTF-16 string UTF8ToUTF16() returns
+ * @param   utf8  the UTF-8 string
+ * @returns       the number of UTF-16 characters or INVALID_LENGTH
+ */
+std::size_t MeasureConversion(utf8_string_view utf8) noexcept {
+	std::size_t length = 0;
+	for (std::size_t i = 0; i < utf8.size();) {
+		// most asset names and labels are ASCII
+		if (static_cast<unsigned char>(utf8[i]) <= 0x7F) {
+			length++;
+			i++;
+			continue;
+		}
+
+		ucodepoint_t point;
+		if (!DecodeUTF8(utf8, i, point)) return INVALID_LENGTH;
+		length += point < 0xD800 || (point > 0xDFFF && point < 0x10000) ? 1 : 2;
+	}
+	return length;
+}
+
+/**
+ * @brief         get the length of the UTF-8 string UTF16ToUTF8() returns
+ * @param   utf16 the UTF-16 string
+ * @returns       the number of UTF-8 characters or INVALID_LENGTH
+ */
+std::size_t MeasureConversion(utf16_string_view utf16) noexcept {
+	std::size_t length = 0;
+	for (std::size_t i = 0; i < utf16.size();) {
+		ucodepoint_t point;
+		if (!DecodeUTF16(utf16, i, point) || point > 0x10FFFF) return INVALID_LENGTH;
+		length += point <= 0x7F ? 1 : point <= 0x7FF ? 2 : point <= 0xFFFF ? 3 : 4;
+	}
+	return length;
+}
+
+/**
+ * @brief         convert a valid UTF-8 string like UTF8ToUTF16()
+ * @param   utf8  the UTF-8 string
+ * @param   out   the output with room for the converted string
+ * @returns       the end of the converted string
+ */
+utf16_string::value_type* Convert(utf8_string_view utf8, utf16_string::value_type* out) noexcept {
+	for (std::size_t i = 0; i < utf8.size();) {
+		if (static_cast<unsigned char>(utf8[i]) <= 0x7F) {
+			*out++ = static_cast<utf16_string::value_type>(utf8[i++]);
+			continue;
+		}
+
+		ucodepoint_t point;
+		DecodeUTF8(utf8, i, point);
+		if (point < 0xD800 || (point > 0xDFFF && point < 0x10000)) {
+			*out++ = static_cast<utf16_string::value_type>(point & 0xFFFF);
+		} else {
+			point  -= 0x10000;
+			*out++  = static_cast<utf16_string::value_type>((point >> 10) + 0xD800);
+			*out++  = static_cast<utf16_string::value_type>((point & 0x3FF) + 0xDC00);
+		}
+	}
+	return out;
+}
+
+/**
+ * @brief         convert a valid UTF-16 string like UTF16ToUTF8()
+ * @param   utf16 the UTF-16 string
+ * @param   out   the output with room for the converted string
+ * @returns       the end of the converted string
+ */
+utf8_string::value_type* Convert(utf16_string_view utf16, utf8_string::value_type* out) noexcept {
+	for (std::size_t i = 0; i < utf16.size();) {
+		ucodepoint_t point;
+		DecodeUTF16(utf16, i, point);
+		if (point <= 0x7F) {
+			*out++ = static_cast<utf8_string::value_type>(point);
+		} else if (point <= 0x7FF) {
+			*out++ = static_cast<utf8_string::value_type>(0xC0 | (point >> 6));
+			*out++ = static_cast<utf8_string::value_type>(0x80 | (point & 0x3F));
+		} else if (point <= 0xFFFF) {
+			*out++ = static_cast<utf8_string::value_type>(0xE0 | (point >> 12));
+			*out++ = static_cast<utf8_string::value_type>(0x80 | ((point >> 6) & 0x3F));
+			*out++ = static_cast<utf8_string::value_type>(0x80 | (point & 0x3F));
+		} else {
+			*out++ = static_cast<utf8_string::value_type>(0xF0 | (point >> 18));
+			*out++ = static_cast<utf8_string::value_type>(0x80 | ((point >> 12) & 0x3F));
+			*out++ = static_cast<utf8_string::value_type>(0x80 | ((point >> 6) & 0x3F));
+			*out++ = static_cast<utf8_string::value_type>(0x80 | (point & 0x3F));
+		}
+	}
+	return out;
+}
+
+/**
+ * @brief         convert an invalid string with the single string conversion
+ *                to get its exception
+ * @param   utf8  the invalid UTF-8 string
+ */
+void ConvertSingle(utf8_string_view utf8) {
+	// may throw ExUtf8StringEncoding or ExUnicodeStringEncoding
+	(void) StringConvert::UTF8ToUTF16(utf8_string(utf8));
+}
+
+/**
+ * @brief         convert an invalid string with the single string conversion
+ *                to get its exception
+ * @param   utf16 the invalid UTF-16 string
+ */
+void ConvertSingle(utf16_string_view utf16) {
+	// may throw ExUtf16StringEncoding or ExUnicodeStringEncoding
+	(void) StringConvert::UTF16ToUTF8(utf16_string(utf16));
+}
+
+/**
+ * @brief               split a batch into chunks of about the same number of
+ *                      input characters
+ * @param   input       the strings of the batch
+ * @param   threadCount the requested number of threads or 0
+ * @returns             one chunk per thread
+ */
+template <typename TInput>
+std::vector<BatchChunk> SplitBatch(std::span<const TInput> input, std::size_t threadCount) {
+	std::size_t total = 0;
+	for (const TInput& str : input) total += str.size();
+
+	if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+	threadCount = std::clamp<std::size_t>(total / MIN_CHARS_PER_THREAD, 1, threadCount);
+
+	std::vector<BatchChunk> chunks;
+	std::size_t             begin = 0, sum = 0;
+	for (std::size_t i = 0; i < input.size(); i++) {
+		sum += input[i].size();
+		if (chunks.size() + 1 < threadCount && sum >= total / threadCount * (chunks.size() + 1)) {
+			chunks.push_back({ begin, i + 1, 0, nullptr });
+			begin = i + 1;
+		}
+	}
+	chunks.push_back({ begin, input.size(), 0, nullptr });
+	return chunks;
+}
+
+/**
+ * @brief        run a function for every chunk, each on its own thread
+ * @param chunks the chunks. The exception of a chunk is stored in it.
+ * @param func   the function to run for a chunk
+ */
+template <typename TFunc>
+void RunBatch(std::vector<BatchChunk>& chunks, TFunc&& func) {
+	auto run = [&](std::size_t chunk) {
+		try {
+			func(chunk);
+		} catch (...) {
+			chunks[chunk].error = std::current_exception();
+		}
+	};
+
+	// the calling thread converts the first chunk and the chunks no thread
+	// could be started for
+	std::vector<std::thread> threads;
+	std::size_t              next = 1;
+	try {
+		threads.reserve(chunks.size() - 1);
+		for (; next < chunks.size(); next++) threads.emplace_back(run, next);
+	} catch (const std::system_error&) {
+	} catch (const std::bad_alloc&) {
+	}
+	run(0);
+	for (; next < chunks.size(); next++) run(next);
+	for (std::thread& thread : threads) thread.join();
+}
+
+} // namespace
+
 u_string StringConvert::UTF8ToUnicode(const utf8_string& utf8) {
 	u_string unicode;
 
@@ -143,4 +389,74 @@ utf8_string StringConvert::UTF16ToUTF8(const utf16_string& utf16) {
 	return UnicodeToUTF8(UTF16ToUnicode(utf16));
 }
 
+utf16_string_batch StringConvert::UTF8ToUTF16Batch(std::span<const utf8_string_view> utf8, std::size_t threadCount) {
+	// may throw ExBatchStringEncoding
+	return ConvertBatch<utf16_string::value_type>(utf8, threadCount);
+}
+
+utf16_string_batch StringConvert::UTF8ToUTF16Batch(std::span<const utf8_string> utf8, std::size_t threadCount) {
+	// may throw ExBatchStringEncoding
+	return ConvertBatch<utf16_string::value_type>(utf8, threadCount);
+}
+
+utf8_string_batch StringConvert::UTF16ToUTF8Batch(std::span<const utf16_string_view> utf16, std::size_t threadCount) {
+	// may throw ExBatchStringEncoding
+	return ConvertBatch<utf8_string::value_type>(utf16, threadCount);
+}
+
+utf8_string_batch StringConvert::UTF16ToUTF8Batch(std::span<const utf16_string> utf16, std::size_t threadCount) {
+	// may throw ExBatchStringEncoding
+	return ConvertBatch<utf8_string::value_type>(utf16, threadCount);
+}
+
+template <typename TOutput, typename TInput>
+StringBatch<TOutput> StringConvert::ConvertBatch(std::span<const TInput> input, std::size_t threadCount) {
+	using view_type = std::basic_string_view<typename TInput::value_type>;
+
+	// measure and validate all strings first, so the result is allocated once
+	// and the conversion does not need to check anything
+	std::vector<BatchChunk>  chunks = SplitBatch(input, threadCount);
+	std::atomic<std::size_t> failed = chunks.size();
+	RunBatch(chunks, [&](std::size_t chunk) {
+		for (std::size_t i = chunks[chunk].begin; i < chunks[chunk].end; i++) {
+			std::size_t length = MeasureConversion(view_type(input[i]));
+			if (length == INVALID_LENGTH) {
+				std::size_t expected = failed.load();
+				while (chunk < expected && !failed.compare_exchange_weak(expected, chunk)) { }
+				try {
+					ConvertSingle(view_type(input[i]));
+				} catch (const ExStringEncoding& e) {
+					throw ExBatchStringEncoding("Invalid string in batch.", std::current_exception(), CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), i, e.GetIndex());
+				}
+				throw ExBatchStringEncoding("Invalid string in batch.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), i, 0);
+			}
+			chunks[chunk].length += length + 1;
+
+			// a string before this chunk is invalid
+			if (failed.load(std::memory_order_relaxed) < chunk) return;
+		}
+	});
+	for (BatchChunk& chunk : chunks) {
+		if (chunk.error) std::rethrow_exception(chunk.error);
+	}
+
+	std::size_t length = 0;
+	for (BatchChunk& chunk : chunks) length += chunk.length;
+	StringBatch<TOutput> batch(input.size(), length);
+
+	RunBatch(chunks, [&](std::size_t chunk) {
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < chunk; i++) offset += chunks[i].length;
+
+		for (std::size_t i = chunks[chunk].begin; i < chunks[chunk].end; i++) {
+			batch.offsets[i] = offset;
+			TOutput* end     = Convert(view_type(input[i]), batch.data + offset);
+			*end             = TOutput(0);
+			offset           = static_cast<std::size_t>(end - batch.data) + 1;
+		}
+	});
+	batch.offsets[input.size()] = length;
+	return batch;
+}
+
 } // namespace Junia
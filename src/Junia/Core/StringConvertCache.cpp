@@ -0,0 +1,124 @@
+/*******************************************************************************
+ *
+ * @file      StringConvertCache.cpp
+ * @brief     Contains the class implementation for memoizing string
+ *            conversions
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Core/StringConvertCache.hpp>
+
+#include <utility>
+
+namespace Junia {
+
+StringConvertCache::StringConvertCache(std::size_t budget)
+	: budget(budget), shardBudget(budget / SHARD_COUNT), hits(0), misses(0), evictions(0) { }
+
+std::shared_ptr<const utf16_string> StringConvertCache::UTF8ToUTF16(utf8_string_view utf8) {
+	std::uint64_t hash  = HashFNV1a64(utf8);
+	Shard&        shard = this->GetShard(hash);
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto [begin, end] = shard.index.equal_range(hash);
+		for (auto it = begin; it != end; ++it) {
+			if (it->second->key != utf8) continue;
+			shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+			this->hits.fetch_add(1, std::memory_order_relaxed);
+			return it->second->value;
+		}
+	}
+	this->misses.fetch_add(1, std::memory_order_relaxed);
+
+	// convert without holding the lock. Another thread may convert the same
+	// string meanwhile, Insert() keeps the first result.
+	Entry entry { hash, utf8_string(utf8), nullptr, 0 };
+
+	// may throw ExUtf8StringEncoding
+	entry.value = std::make_shared<const utf16_string>(StringConvert::UTF8ToUTF16(entry.key));
+	entry.size  = GetEntrySize(entry.key, *entry.value);
+
+	std::shared_ptr<const utf16_string> result = entry.value;
+	if (entry.size <= this->shardBudget) this->Insert(shard, std::move(entry));
+	return result;
+}
+
+void StringConvertCache::Clear() noexcept {
+	for (Shard& shard : this->shards) {
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.index.clear();
+		shard.entries.clear();
+		shard.bytes = 0;
+	}
+}
+
+void StringConvertCache::ResetStatistics() noexcept {
+	this->hits.store(0, std::memory_order_relaxed);
+	this->misses.store(0, std::memory_order_relaxed);
+	this->evictions.store(0, std::memory_order_relaxed);
+}
+
+StringConvertCacheStatistics StringConvertCache::GetStatistics() const noexcept {
+	StringConvertCacheStatistics statistics;
+	statistics.hits      = this->hits.load(std::memory_order_relaxed);
+	statistics.misses    = this->misses.load(std::memory_order_relaxed);
+	statistics.evictions = this->evictions.load(std::memory_order_relaxed);
+	statistics.budget    = this->budget;
+	for (const Shard& shard : this->shards) {
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		statistics.entryCount += shard.entries.size();
+		statistics.bytes      += shard.bytes;
+	}
+	if (statistics.hits + statistics.misses != 0) statistics.hitRate = static_cast<double>(statistics.hits) / static_cast<double>(statistics.hits + statistics.misses);
+	return statistics;
+}
+
+std::size_t StringConvertCache::GetBudget() const noexcept {
+	return this->budget;
+}
+
+std::size_t StringConvertCache::GetEntrySize(const utf8_string& key, const utf16_string& value) noexcept {
+	// estimate of the list node, the index node and the shared string with its
+	// control block
+	constexpr std::size_t OVERHEAD = sizeof(Entry) + sizeof(utf16_string) + 8 * sizeof(void*);
+	return OVERHEAD + key.capacity() + value.capacity() * sizeof(utf16_string::value_type);
+}
+
+StringConvertCache::Shard& StringConvertCache::GetShard(std::uint64_t hash) noexcept {
+	// the low bits of FNV-1a are poorly distributed for short strings
+	return this->shards[HashMix64(hash) % SHARD_COUNT];
+}
+
+void StringConvertCache::Insert(Shard& shard, Entry&& entry) {
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto [begin, end] = shard.index.equal_range(entry.hash);
+	for (auto it = begin; it != end; ++it)
+		if (it->second->key == entry.key) return;
+
+	shard.entries.push_front(std::move(entry));
+	try {
+		shard.index.emplace(shard.entries.front().hash, shard.entries.begin());
+	} catch (...) {
+		shard.entries.pop_front();
+		throw;
+	}
+	shard.bytes += shard.entries.front().size;
+
+	while (shard.bytes > this->shardBudget) {
+		Entry& last     = shard.entries.back();
+		auto [from, to] = shard.index.equal_range(last.hash);
+		for (auto it = from; it != to; ++it) {
+			if (&*it->second != &last) continue;
+			shard.index.erase(it);
+			break;
+		}
+		shard.bytes -= last.size;
+		shard.entries.pop_back();
+		this->evictions.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+} // namespace Junia
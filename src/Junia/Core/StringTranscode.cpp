@@ -0,0 +1,460 @@
+/*******************************************************************************
+ *
+ * @file      StringTranscode.cpp
+ * @brief     Contains the class implementation for transcoding text between
+ *            UTF-8 and legacy or byte order dependent encodings
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Core/StringTranscode.hpp>
+
+#include <Junia/Math/Simd.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Core/StringTranscode.cpp";
+
+namespace Junia {
+
+namespace {
+
+constexpr ucodepoint_t INVALID_CODEPOINT = 0xFFFFFFFF;
+
+constexpr std::byte BOM_UTF8[]    = { std::byte { 0xEF }, std::byte { 0xBB }, std::byte { 0xBF } };
+constexpr std::byte BOM_UTF16LE[] = { std::byte { 0xFF }, std::byte { 0xFE } };
+constexpr std::byte BOM_UTF16BE[] = { std::byte { 0xFE }, std::byte { 0xFF } };
+constexpr std::byte BOM_UTF32LE[] = { std::byte { 0xFF }, std::byte { 0xFE }, std::byte { 0x00 }, std::byte { 0x00 } };
+constexpr std::byte BOM_UTF32BE[] = { std::byte { 0x00 }, std::byte { 0x00 }, std::byte { 0xFE }, std::byte { 0xFF } };
+
+// the codepoints of the bytes 0x80 to 0x9F in Windows-1252, 0 if undefined
+constexpr ucodepoint_t WINDOWS1252_C1[32] = {
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x0000, 0x017D, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x0000, 0x017E, 0x0178
+};
+
+/**
+ * @brief the UTF-8 sequence of a byte of a single byte encoding
+ */
+struct ByteSequence {
+	std::uint8_t length; // 0 if the byte is undefined
+	char         bytes[3];
+};
+
+using ByteTable = std::array<ByteSequence, 256>;
+
+constexpr ByteSequence MakeSequence(ucodepoint_t codepoint) noexcept {
+	if (codepoint < 0x80) return { 1, { static_cast<char>(codepoint), 0, 0 } };
+	if (codepoint < 0x800) return { 2, { static_cast<char>(0xC0 | (codepoint >> 6)), static_cast<char>(0x80 | (codepoint & 0x3F)), 0 } };
+	return { 3, { static_cast<char>(0xE0 | (codepoint >> 12)), static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)), static_cast<char>(0x80 | (codepoint & 0x3F)) } };
+}
+
+constexpr ByteTable MakeByteTable(bool windows1252) noexcept {
+	ByteTable table {};
+	for (ucodepoint_t i = 0; i < 256; i++) {
+		if (windows1252 && i >= 0x80 && i < 0xA0) {
+			ucodepoint_t codepoint = WINDOWS1252_C1[i - 0x80];
+			table[i]               = codepoint == 0 ? ByteSequence { 0, { 0, 0, 0 } } : MakeSequence(codepoint);
+		} else {
+			table[i] = MakeSequence(i);
+		}
+	}
+	return table;
+}
+
+constexpr ByteTable LATIN1_TABLE      = MakeByteTable(false);
+constexpr ByteTable WINDOWS1252_TABLE = MakeByteTable(true);
+
+#if defined(JUNIA_MATH_SSE)
+/**
+ * @brief        count the leading ASCII bytes of a block of 16 bytes
+ * @param   data the block
+ * @returns      the number of ASCII bytes before the first non-ASCII byte
+ */
+inline int CountASCII16(const void* data) noexcept {
+	int mask = _mm_movemask_epi8(_mm_loadu_si128(static_cast<const __m128i*>(data)));
+	return mask == 0 ? 16 : std::countr_zero(static_cast<unsigned int>(mask));
+}
+#endif
+
+/**
+ * @brief        get the length of the leading ASCII run
+ * @param   data the text
+ * @param   size the size of the text in bytes
+ * @returns      the number of bytes before the first non-ASCII byte
+ */
+std::size_t SkipASCII(const unsigned char* data, std::size_t size) noexcept {
+	std::size_t i = 0;
+#if defined(JUNIA_MATH_SSE)
+	for (; i + 16 <= size; i += 16) {
+		int count = CountASCII16(data + i);
+		if (count != 16) return i + count;
+	}
+#endif
+	while (i < size && data[i] < 0x80) i++;
+	return i;
+}
+
+/**
+ * @brief        decode one UTF-8 sequence and reject overlong sequences,
+ *               surrogates and codepoints above U+10FFFF
+ * @param   data the text
+ * @param   size the size of the text in bytes
+ * @param   i    the index of the sequence. Advanced past it on success.
+ * @returns      the codepoint or INVALID_CODEPOINT
+ */
+ucodepoint_t DecodeUTF8(const unsigned char* data, std::size_t size, std::size_t& i) noexcept {
+	unsigned char c = data[i];
+	if (c < 0x80) {
+		i++;
+		return c;
+	}
+
+	std::size_t   length = 0;
+	ucodepoint_t  codepoint;
+	unsigned char low = 0x80, high = 0xBF;
+	if (c >= 0xC2 && c <= 0xDF) {
+		length    = 2;
+		codepoint = c & 0x1F;
+	} else if (c >= 0xE0 && c <= 0xEF) {
+		length    = 3;
+		codepoint = c & 0x0F;
+		if (c == 0xE0) low = 0xA0;
+		else if (c == 0xED) high = 0x9F;
+	} else if (c >= 0xF0 && c <= 0xF4) {
+		length    = 4;
+		codepoint = c & 0x07;
+		if (c == 0xF0) low = 0x90;
+		else if (c == 0xF4) high = 0x8F;
+	} else {
+		return INVALID_CODEPOINT;
+	}
+	if (size - i < length) return INVALID_CODEPOINT;
+
+	// only the first continuation byte has a narrower range
+	if (data[i + 1] < low || data[i + 1] > high) return INVALID_CODEPOINT;
+	for (std::size_t j = 1; j < length; j++) {
+		unsigned char next = data[i + j];
+		if ((next & 0xC0) != 0x80) return INVALID_CODEPOINT;
+		codepoint = (codepoint << 6) | (next & 0x3F);
+	}
+	i += length;
+	return codepoint;
+}
+
+/**
+ * @brief             write a codepoint as UTF-8
+ * @param   out       the output. Must have room for 4 bytes.
+ * @param   codepoint the codepoint
+ * @returns           the output after the written bytes
+ */
+inline char* EncodeUTF8(char* out, ucodepoint_t codepoint) noexcept {
+	if (codepoint < 0x80) {
+		*out++ = static_cast<char>(codepoint);
+	} else if (codepoint < 0x800) {
+		*out++ = static_cast<char>(0xC0 | (codepoint >> 6));
+		*out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+	} else if (codepoint < 0x10000) {
+		*out++ = static_cast<char>(0xE0 | (codepoint >> 12));
+		*out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+		*out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+	} else {
+		*out++ = static_cast<char>(0xF0 | (codepoint >> 18));
+		*out++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+		*out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+		*out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+	}
+	return out;
+}
+
+/**
+ * @brief      check that a text is strictly valid UTF-8
+ * @param data the text
+ * @param size the size of the text in bytes
+ *
+ * @throws ExUtf8StringEncoding if the text was invalid
+ */
+void ValidateUTF8(const unsigned char* data, std::size_t size) {
+	std::size_t i = 0;
+	while (i < size) {
+		i += SkipASCII(data + i, size - i);
+		if (i == size) break;
+		std::size_t index = i;
+		if (DecodeUTF8(data, size, i) == INVALID_CODEPOINT) throw ExUtf8StringEncoding("Invalid UTF-8 string. Unexpected character encountered.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(reinterpret_cast<const char*>(data), size), index);
+	}
+}
+
+inline std::uint32_t Load16(const unsigned char* data, bool bigEndian) noexcept {
+	return bigEndian ? (data[0] << 8) | data[1] : data[0] | (data[1] << 8);
+}
+
+inline std::uint32_t Load32(const unsigned char* data, bool bigEndian) noexcept {
+	if (bigEndian) return (std::uint32_t(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+	return data[0] | (data[1] << 8) | (data[2] << 16) | (std::uint32_t(data[3]) << 24);
+}
+
+inline std::byte* Store16(std::byte* out, std::uint32_t unit, bool bigEndian) noexcept {
+	out[bigEndian ? 0 : 1] = std::byte(unit >> 8);
+	out[bigEndian ? 1 : 0] = std::byte(unit & 0xFF);
+	return out + 2;
+}
+
+inline std::byte* Store32(std::byte* out, std::uint32_t value, bool bigEndian) noexcept {
+	for (int j = 0; j < 4; j++) out[bigEndian ? 3 - j : j] = std::byte((value >> (8 * j)) & 0xFF);
+	return out + 4;
+}
+
+utf8_string DecodeSingleByte(const unsigned char* data, std::size_t size, const ByteTable& table) {
+	// measure first so the output is allocated exactly once
+	std::size_t length = 0;
+	std::size_t i      = 0;
+#if defined(JUNIA_MATH_SSE)
+	if (&table == &LATIN1_TABLE) {
+		// every byte above 0x7F becomes two bytes in UTF-8
+		for (; i + 16 <= size; i += 16) length += 16 + std::popcount(static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)))));
+	}
+#endif
+	for (; i < size; i++) {
+		std::uint8_t sequence = table[data[i]].length;
+		if (sequence == 0) throw ExWindows1252StringEncoding("Invalid Windows-1252 string. Undefined character encountered.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), i, data[i]);
+		length += sequence;
+	}
+
+	utf8_string utf8(length, '\0');
+	char*       out = utf8.data();
+	i               = 0;
+	while (i < size) {
+#if defined(JUNIA_MATH_SSE)
+		if (i + 16 <= size) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			if (_mm_movemask_epi8(block) == 0) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+				out += 16;
+				i   += 16;
+				continue;
+			}
+		}
+#endif
+		const ByteSequence& sequence = table[data[i++]];
+		out[0]                       = sequence.bytes[0];
+		if (sequence.length > 1) {
+			out[1] = sequence.bytes[1];
+			if (sequence.length > 2) out[2] = sequence.bytes[2];
+		}
+		out += sequence.length;
+	}
+	return utf8;
+}
+
+std::vector<std::byte> EncodeSingleByte(const unsigned char* data, std::size_t size, bool windows1252, std::span<const std::byte> bom) {
+	// every codepoint takes at least one byte in UTF-8
+	std::vector<std::byte> result(bom.size() + size);
+	std::copy(bom.begin(), bom.end(), result.begin());
+	std::byte*  out = result.data() + bom.size();
+	std::size_t i   = 0;
+	while (i < size) {
+#if defined(JUNIA_MATH_SSE)
+		if (i + 16 <= size) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			if (_mm_movemask_epi8(block) == 0) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+				out += 16;
+				i   += 16;
+				continue;
+			}
+		}
+#endif
+		std::size_t  index     = i;
+		ucodepoint_t codepoint = DecodeUTF8(data, size, i);
+		if (codepoint == INVALID_CODEPOINT) throw ExUtf8StringEncoding("Invalid UTF-8 string. Unexpected character encountered.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(reinterpret_cast<const char*>(data), size), index);
+
+		if (codepoint < 0x80 || (codepoint >= 0xA0 && codepoint <= 0xFF) || (!windows1252 && codepoint <= 0xFF)) {
+			*out++ = std::byte(codepoint);
+		} else if (!windows1252) {
+			throw ExLatin1StringEncoding("Codepoint is not representable in Latin-1.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), index, codepoint);
+		} else {
+			std::size_t j = 0;
+			while (j < 32 && WINDOWS1252_C1[j] != codepoint) j++;
+			if (j == 32) throw ExWindows1252StringEncoding("Codepoint is not representable in Windows-1252.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), index, codepoint);
+			*out++ = std::byte(0x80 + j);
+		}
+	}
+	result.resize(out - result.data());
+	return result;
+}
+
+utf8_string DecodeUTF16(const unsigned char* data, std::size_t size, bool bigEndian) {
+	std::endian byteOrder = bigEndian ? std::endian::big : std::endian::little;
+	if (size % 2 != 0) throw ExUtf16ByteStringEncoding("Invalid UTF-16 string. Odd number of bytes.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size - 1, byteOrder);
+
+	// a code unit takes at most three bytes in UTF-8, a surrogate pair four
+	utf8_string utf8(size / 2 * 3, '\0');
+	char*       out = utf8.data();
+	std::size_t i   = 0;
+	while (i < size) {
+#if defined(JUNIA_MATH_SSE)
+		if (i + 16 <= size) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			if (bigEndian) block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16(static_cast<short>(0xFF80))), _mm_setzero_si128())) == 0xFFFF) {
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(block, block));
+				out += 8;
+				i   += 16;
+				continue;
+			}
+		}
+#endif
+		ucodepoint_t codepoint = Load16(data + i, bigEndian);
+		if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+			std::uint32_t low = i + 4 <= size ? Load16(data + i + 2, bigEndian) : 0;
+			if (low < 0xDC00 || low > 0xDFFF) throw ExUtf16ByteStringEncoding("Invalid UTF-16 string. High surrogate without low surrogate.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), i, byteOrder);
+			codepoint  = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+			i         += 4;
+		} else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+			throw ExUtf16ByteStringEncoding("Invalid UTF-16 string. Low surrogate without high surrogate.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), i, byteOrder);
+		} else {
+			i += 2;
+		}
+		out = EncodeUTF8(out, codepoint);
+	}
+	utf8.resize(out - utf8.data());
+	return utf8;
+}
+
+utf8_string DecodeUTF32(const unsigned char* data, std::size_t size, bool bigEndian) {
+	std::endian byteOrder = bigEndian ? std::endian::big : std::endian::little;
+	if (size % 4 != 0) throw ExUtf32StringEncoding("Invalid UTF-32 string. Size is not a multiple of 4 bytes.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size - size % 4, byteOrder);
+
+	// a codepoint takes at most four bytes in UTF-8
+	utf8_string utf8(size, '\0');
+	char*       out = utf8.data();
+	for (std::size_t i = 0; i < size; i += 4) {
+		ucodepoint_t codepoint = Load32(data + i, bigEndian);
+		if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) throw ExUtf32StringEncoding("Invalid UTF-32 string. Invalid codepoint encountered.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), i, byteOrder);
+		out = EncodeUTF8(out, codepoint);
+	}
+	utf8.resize(out - utf8.data());
+	return utf8;
+}
+
+std::vector<std::byte> EncodeUTF16or32(const unsigned char* data, std::size_t size, bool utf32, bool bigEndian, std::span<const std::byte> bom) {
+	// a UTF-8 byte becomes at most two UTF-16 or four UTF-32 bytes
+	std::vector<std::byte> result(bom.size() + size * (utf32 ? 4 : 2));
+	std::copy(bom.begin(), bom.end(), result.begin());
+	std::byte*  out = result.data() + bom.size();
+	std::size_t i   = 0;
+	while (i < size) {
+#if defined(JUNIA_MATH_SSE)
+		if (!utf32 && i + 16 <= size) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			if (_mm_movemask_epi8(block) == 0) {
+				__m128i zero = _mm_setzero_si128();
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), bigEndian ? _mm_unpacklo_epi8(zero, block) : _mm_unpacklo_epi8(block, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), bigEndian ? _mm_unpackhi_epi8(zero, block) : _mm_unpackhi_epi8(block, zero));
+				out += 32;
+				i   += 16;
+				continue;
+			}
+		}
+#endif
+		std::size_t  index     = i;
+		ucodepoint_t codepoint = DecodeUTF8(data, size, i);
+		if (codepoint == INVALID_CODEPOINT) throw ExUtf8StringEncoding("Invalid UTF-8 string. Unexpected character encountered.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(reinterpret_cast<const char*>(data), size), index);
+
+		if (utf32) {
+			out = Store32(out, codepoint, bigEndian);
+		} else if (codepoint < 0x10000) {
+			out = Store16(out, codepoint, bigEndian);
+		} else {
+			codepoint -= 0x10000;
+			out        = Store16(out, 0xD800 + (codepoint >> 10), bigEndian);
+			out        = Store16(out, 0xDC00 + (codepoint & 0x3FF), bigEndian);
+		}
+	}
+	result.resize(out - result.data());
+	return result;
+}
+
+} // namespace
+
+TextEncodingDetection StringTranscode::DetectEncoding(std::span<const std::byte> data, TextEncoding fallback) noexcept {
+	auto startsWith = [data](std::span<const std::byte> bom) {
+		return data.size() >= bom.size() && std::memcmp(data.data(), bom.data(), bom.size()) == 0;
+	};
+
+	// UTF-32LE first since its byte order mark starts with the one of UTF-16LE
+	if (startsWith(BOM_UTF32LE)) return { TextEncoding::UTF32LE, sizeof(BOM_UTF32LE) };
+	if (startsWith(BOM_UTF16LE)) return { TextEncoding::UTF16LE, sizeof(BOM_UTF16LE) };
+	if (startsWith(BOM_UTF8)) return { TextEncoding::UTF8, sizeof(BOM_UTF8) };
+	if (startsWith(BOM_UTF16BE)) return { TextEncoding::UTF16BE, sizeof(BOM_UTF16BE) };
+	if (startsWith(BOM_UTF32BE)) return { TextEncoding::UTF32BE, sizeof(BOM_UTF32BE) };
+	return { fallback, 0 };
+}
+
+std::span<const std::byte> StringTranscode::GetBOM(TextEncoding encoding) noexcept {
+	switch (encoding) {
+		case TextEncoding::UTF8: return BOM_UTF8;
+		case TextEncoding::UTF16LE: return BOM_UTF16LE;
+		case TextEncoding::UTF16BE: return BOM_UTF16BE;
+		case TextEncoding::UTF32LE: return BOM_UTF32LE;
+		case TextEncoding::UTF32BE: return BOM_UTF32BE;
+		default: return {};
+	}
+}
+
+utf8_string StringTranscode::Decode(std::span<const std::byte> data, TextEncoding encoding) {
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data.data());
+	switch (encoding) {
+		case TextEncoding::UTF8:
+			// may throw ExUtf8StringEncoding
+			ValidateUTF8(bytes, data.size());
+			return utf8_string(reinterpret_cast<const char*>(bytes), data.size());
+		// may throw ExUtf16ByteStringEncoding
+		case TextEncoding::UTF16LE: return DecodeUTF16(bytes, data.size(), false);
+		case TextEncoding::UTF16BE: return DecodeUTF16(bytes, data.size(), true);
+		// may throw ExUtf32StringEncoding
+		case TextEncoding::UTF32LE: return DecodeUTF32(bytes, data.size(), false);
+		case TextEncoding::UTF32BE: return DecodeUTF32(bytes, data.size(), true);
+		case TextEncoding::Latin1: return DecodeSingleByte(bytes, data.size(), LATIN1_TABLE);
+		// may throw ExWindows1252StringEncoding
+		case TextEncoding::Windows1252: return DecodeSingleByte(bytes, data.size(), WINDOWS1252_TABLE);
+	}
+	throw ExInvalidArgument("Unknown text encoding.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "encoding");
+}
+
+utf8_string StringTranscode::DecodeText(std::span<const std::byte> data, TextEncoding fallback) {
+	TextEncodingDetection detection = DetectEncoding(data, fallback);
+
+	// may throw ExStringEncoding
+	return Decode(data.subspan(detection.bomSize), detection.encoding);
+}
+
+std::vector<std::byte> StringTranscode::Encode(utf8_string_view utf8, TextEncoding encoding, bool bom) {
+	const unsigned char*       bytes = reinterpret_cast<const unsigned char*>(utf8.data());
+	std::span<const std::byte> mark  = bom ? GetBOM(encoding) : std::span<const std::byte>();
+	switch (encoding) {
+		case TextEncoding::UTF8: {
+			// may throw ExUtf8StringEncoding
+			ValidateUTF8(bytes, utf8.size());
+			std::vector<std::byte> result(mark.begin(), mark.end());
+			result.insert(result.end(), reinterpret_cast<const std::byte*>(bytes), reinterpret_cast<const std::byte*>(bytes) + utf8.size());
+			return result;
+		}
+		// may throw ExUtf8StringEncoding
+		case TextEncoding::UTF16LE: return EncodeUTF16or32(bytes, utf8.size(), false, false, mark);
+		case TextEncoding::UTF16BE: return EncodeUTF16or32(bytes, utf8.size(), false, true, mark);
+		case TextEncoding::UTF32LE: return EncodeUTF16or32(bytes, utf8.size(), true, false, mark);
+		case TextEncoding::UTF32BE: return EncodeUTF16or32(bytes, utf8.size(), true, true, mark);
+		// may throw ExUtf8StringEncoding, ExLatin1StringEncoding or ExWindows1252StringEncoding
+		case TextEncoding::Latin1: return EncodeSingleByte(bytes, utf8.size(), false, mark);
+		case TextEncoding::Windows1252: return EncodeSingleByte(bytes, utf8.size(), true, mark);
+	}
+	throw ExInvalidArgument("Unknown text encoding.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "encoding");
+}
+
+} // namespace Junia
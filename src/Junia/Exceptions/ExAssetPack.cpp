@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExAssetPack.cpp
+ * @brief     Contains the ExAssetPack exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExAssetPack.hpp>
+
+namespace Junia {
+
+ExAssetPack::ExAssetPack(const utf8_string& msg, std::exception_ptr previous, CodePos location, const utf8_string& path) noexcept
+	: Exception(msg, previous, location), path(path) { }
+
+const utf8_string& ExAssetPack::GetPath() const noexcept {
+	return this->path;
+}
+
+} // namespace Junia
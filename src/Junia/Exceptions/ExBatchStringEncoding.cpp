@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExBatchStringEncoding.cpp
+ * @brief     Contains the ExBatchStringEncoding exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExBatchStringEncoding.hpp>
+
+namespace Junia {
+
+ExBatchStringEncoding::ExBatchStringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t element, std::size_t index) noexcept
+	: ExStringEncoding(msg, previous, location, index), element(element) { }
+
+std::size_t ExBatchStringEncoding::GetElement() const noexcept {
+	return this->element;
+}
+
+} // namespace Junia
@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExCompression.cpp
+ * @brief     Contains the ExCompression exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExCompression.hpp>
+
+namespace Junia {
+
+ExCompression::ExCompression(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t offset) noexcept
+	: Exception(msg, previous, location), offset(offset) { }
+
+std::size_t ExCompression::GetOffset() const noexcept {
+	return this->offset;
+}
+
+} // namespace Junia
@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExDeviceMemory.cpp
+ * @brief     Contains the ExDeviceMemory exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExDeviceMemory.hpp>
+
+namespace Junia {
+
+ExDeviceMemory::ExDeviceMemory(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::uint64_t size) noexcept
+	: Exception(msg, previous, location), size(size) { }
+
+std::uint64_t ExDeviceMemory::GetSize() const noexcept {
+	return this->size;
+}
+
+} // namespace Junia
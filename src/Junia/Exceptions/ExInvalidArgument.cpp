@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExInvalidArgument.cpp
+ * @brief     Contains the ExInvalidArgument exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExInvalidArgument.hpp>
+
+namespace Junia {
+
+ExInvalidArgument::ExInvalidArgument(const utf8_string& msg, std::exception_ptr previous, CodePos location, const utf8_string& argument) noexcept
+	: Exception(msg, previous, location), argument(argument) { }
+
+const utf8_string& ExInvalidArgument::GetArgument() const noexcept {
+	return this->argument;
+}
+
+} // namespace Junia
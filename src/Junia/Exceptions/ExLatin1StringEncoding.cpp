@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExLatin1StringEncoding.cpp
+ * @brief     Contains the ExLatin1StringEncoding exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExLatin1StringEncoding.hpp>
+
+namespace Junia {
+
+ExLatin1StringEncoding::ExLatin1StringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, ucodepoint_t codepoint) noexcept
+	: ExStringEncoding(msg, previous, location, index), codepoint(codepoint) { }
+
+ucodepoint_t ExLatin1StringEncoding::GetCodepoint() const noexcept {
+	return this->codepoint;
+}
+
+} // namespace Junia
@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExLocalization.cpp
+ * @brief     Contains the ExLocalization exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExLocalization.hpp>
+
+namespace Junia {
+
+ExLocalization::ExLocalization(const utf8_string& msg, std::exception_ptr previous, CodePos location, const utf8_string& key) noexcept
+	: Exception(msg, previous, location), key(key) { }
+
+const utf8_string& ExLocalization::GetKey() const noexcept {
+	return this->key;
+}
+
+} // namespace Junia
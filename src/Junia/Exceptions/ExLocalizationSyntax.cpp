@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExLocalizationSyntax.cpp
+ * @brief     Contains the ExLocalizationSyntax exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExLocalizationSyntax.hpp>
+
+namespace Junia {
+
+ExLocalizationSyntax::ExLocalizationSyntax(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t line) noexcept
+	: Exception(msg, previous, location), line(line) { }
+
+std::size_t ExLocalizationSyntax::GetLine() const noexcept {
+	return this->line;
+}
+
+} // namespace Junia
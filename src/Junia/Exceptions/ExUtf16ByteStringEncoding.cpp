@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExUtf16ByteStringEncoding.cpp
+ * @brief     Contains the ExUtf16ByteStringEncoding exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExUtf16ByteStringEncoding.hpp>
+
+namespace Junia {
+
+ExUtf16ByteStringEncoding::ExUtf16ByteStringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, std::endian byteOrder) noexcept
+	: ExStringEncoding(msg, previous, location, index), byteOrder(byteOrder) { }
+
+std::endian ExUtf16ByteStringEncoding::GetByteOrder() const noexcept {
+	return this->byteOrder;
+}
+
+} // namespace Junia
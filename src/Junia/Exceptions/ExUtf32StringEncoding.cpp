@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExUtf32StringEncoding.cpp
+ * @brief     Contains the ExUtf32StringEncoding exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExUtf32StringEncoding.hpp>
+
+namespace Junia {
+
+ExUtf32StringEncoding::ExUtf32StringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, std::endian byteOrder) noexcept
+	: ExStringEncoding(msg, previous, location, index), byteOrder(byteOrder) { }
+
+std::endian ExUtf32StringEncoding::GetByteOrder() const noexcept {
+	return this->byteOrder;
+}
+
+} // namespace Junia
@@ -0,0 +1,22 @@
+/*******************************************************************************
+ *
+ * @file      ExWindows1252StringEncoding.cpp
+ * @brief     Contains the ExWindows1252StringEncoding exception class implementation
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Exceptions/ExWindows1252StringEncoding.hpp>
+
+namespace Junia {
+
+ExWindows1252StringEncoding::ExWindows1252StringEncoding(const utf8_string& msg, std::exception_ptr previous, CodePos location, std::size_t index, ucodepoint_t codepoint) noexcept
+	: ExStringEncoding(msg, previous, location, index), codepoint(codepoint) { }
+
+ucodepoint_t ExWindows1252StringEncoding::GetCodepoint() const noexcept {
+	return this->codepoint;
+}
+
+} // namespace Junia
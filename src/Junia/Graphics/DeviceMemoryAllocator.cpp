@@ -0,0 +1,435 @@
+/*******************************************************************************
+ *
+ * @file      DeviceMemoryAllocator.cpp
+ * @brief     Contains the class implementations for sub-allocating device
+ *            memory from large blocks
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Graphics/DeviceMemoryAllocator.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <exception>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Graphics/DeviceMemoryAllocator.cpp";
+
+namespace Junia {
+
+static constexpr std::uint64_t SMALL_HEAP_SIZE = 1024ull * 1024 * 1024;
+
+DeviceMemoryAllocator::DeviceMemoryAllocator(DeviceMemoryBackend& backend, std::uint64_t blockSize)
+	: backend(backend), separateImages(backend.GetBufferImageGranularity() > 1) {
+	std::span<const DeviceMemoryType> types = backend.GetMemoryTypes();
+	std::span<const DeviceMemoryHeap> heaps = backend.GetMemoryHeaps();
+
+	this->types.assign(types.begin(), types.end());
+	for (const DeviceMemoryHeap& heap : heaps) {
+		if (blockSize != 0) this->blockSizes.push_back(blockSize);
+		else this->blockSizes.push_back(heap.size <= SMALL_HEAP_SIZE ? heap.size / 8 : DEFAULT_BLOCK_SIZE);
+	}
+	this->pools.resize(this->types.size() * 2);
+	this->statistics.resize(heaps.size());
+}
+
+DeviceMemoryAllocator::~DeviceMemoryAllocator() {
+	for (Pool& pool : this->pools) {
+		for (std::unique_ptr<Block>& block : pool.blocks) {
+			for (DeviceMemoryAllocation* allocation : block->allocations) delete allocation;
+			this->FreeMemory(block->memory, block->memoryType, block->placement.GetSize(), block->mappedData != nullptr);
+		}
+	}
+	for (DeviceMemoryAllocation* allocation : this->dedicated) {
+		this->FreeMemory(allocation->memory, allocation->memoryType, allocation->size, allocation->mappedData != nullptr);
+		delete allocation;
+	}
+}
+
+DeviceMemoryAllocation* DeviceMemoryAllocator::Allocate(const DeviceMemoryRequest& request) {
+	if (request.size == 0) throw ExInvalidArgument("Allocation size is 0.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "request");
+	if (!std::has_single_bit(request.alignment)) throw ExInvalidArgument("Alignment is not a power of two.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "request");
+
+	// try the types with the most preferred flags first. Among those, types
+	// without unrequested flags are used first, so e.g. host memory requests
+	// do not use up device local host visible memory.
+	std::vector<std::uint32_t> candidates;
+	for (std::uint32_t i = 0; i < this->types.size(); i++) {
+		if ((request.memoryTypeBits >> i & 1) && (this->types[i].flags & request.requiredFlags) == request.requiredFlags) candidates.push_back(i);
+	}
+	if (candidates.empty()) throw ExDeviceMemory("No memory type fits the request.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), request.size);
+
+	std::uint32_t wanted = request.requiredFlags | request.preferredFlags;
+	std::stable_sort(candidates.begin(), candidates.end(), [&](std::uint32_t a, std::uint32_t b) {
+		int preferredA = std::popcount(this->types[a].flags & request.preferredFlags);
+		int preferredB = std::popcount(this->types[b].flags & request.preferredFlags);
+		if (preferredA != preferredB) return preferredA > preferredB;
+		return std::popcount(this->types[a].flags & ~wanted) < std::popcount(this->types[b].flags & ~wanted);
+	});
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	std::exception_ptr          error;
+	for (std::uint32_t memoryType : candidates) {
+		try {
+			return this->AllocateFromType(memoryType, request);
+		} catch (const ExDeviceMemory&) {
+			error = std::current_exception();
+		}
+	}
+	throw ExDeviceMemory("All fitting memory types are out of memory.", error, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), request.size);
+}
+
+void DeviceMemoryAllocator::Free(DeviceMemoryAllocation* allocation) noexcept {
+	if (allocation == nullptr) return;
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	DeviceMemoryStatistics&     statistics  = this->statistics[this->types[allocation->memoryType].heapIndex];
+	statistics.allocationCount--;
+	statistics.allocationBytes             -= allocation->size;
+
+	// Defragment() is copying the allocation without holding the lock
+	if (allocation->moving) {
+		allocation->freed = true;
+		return;
+	}
+
+	Block* block = allocation->block;
+	if (block == nullptr) {
+		Unlink(this->dedicated, allocation);
+		this->FreeMemory(allocation->memory, allocation->memoryType, allocation->size, allocation->mappedData != nullptr);
+		delete allocation;
+		return;
+	}
+
+	block->placement.Free(allocation->node);
+	Unlink(block->allocations, allocation);
+	delete allocation;
+
+	// keep one empty block per pool, so allocations that come and go do not
+	// allocate device memory every time
+	if (block->placement.IsEmpty()) {
+		for (std::unique_ptr<Block>& other : this->pools[block->pool].blocks) {
+			if (other.get() != block && other->placement.IsEmpty()) {
+				this->DestroyBlock(*block);
+				break;
+			}
+		}
+	}
+}
+
+DeviceMemoryDefragmentation DeviceMemoryAllocator::Defragment(const std::function<void(const DeviceMemoryMove&)>& move) {
+	std::lock_guard<std::mutex> defragmentLock(this->defragmentMutex);
+	std::vector<PlannedMove>    planned;
+
+	// reserve the targets of all moves while locked. The reserved ranges keep
+	// every involved block from becoming empty and being destroyed while the
+	// callbacks run.
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		try {
+			for (Pool& pool : this->pools) {
+				// move allocations from the least used blocks into the most used ones
+				std::stable_sort(pool.blocks.begin(), pool.blocks.end(), [](const std::unique_ptr<Block>& a, const std::unique_ptr<Block>& b) {
+					return a->placement.GetSize() - a->placement.GetFreeSize() > b->placement.GetSize() - b->placement.GetFreeSize();
+				});
+
+				for (std::size_t src = pool.blocks.size(); src-- > 1;) {
+					Block& source = *pool.blocks[src];
+
+					// only empty a block if the fuller blocks can take all of it.
+					// Blocks that receive moves cannot be emptied.
+					std::uint64_t available = 0;
+					for (std::size_t dst = 0; dst < src; dst++) available += pool.blocks[dst]->placement.GetFreeSize();
+					if (source.placement.IsEmpty() || source.pendingMoves != 0 || available < source.placement.GetSize() - source.placement.GetFreeSize()) continue;
+
+					for (DeviceMemoryAllocation* allocation : source.allocations) {
+						for (std::size_t dst = 0; dst < src; dst++) {
+							Block& target = *pool.blocks[dst];
+							if (planned.size() == planned.capacity()) planned.reserve(planned.size() * 2 + 16);
+							ReserveLink(target.allocations, target.pendingMoves);
+							TlsfAllocator::Allocation placed = target.placement.Allocate(allocation->size, allocation->alignment);
+							if (placed.node == TlsfAllocator::INVALID_NODE) continue;
+
+							planned.push_back({ allocation, &target, placed, target.mappedData != nullptr ? target.mappedData + placed.offset : nullptr });
+							target.pendingMoves++;
+							allocation->moving = true;
+							break;
+						}
+					}
+				}
+			}
+		} catch (...) {
+			for (PlannedMove& plan : planned) {
+				plan.target->placement.Free(plan.placed.node);
+				plan.target->pendingMoves--;
+				plan.allocation->moving = false;
+			}
+			throw;
+		}
+	}
+
+	// copy the data without holding the lock, so the callback can allocate
+	// staging memory. Allocations freed meanwhile stay alive until the end.
+	std::size_t        copied = 0;
+	std::exception_ptr error  = nullptr;
+	for (; copied < planned.size(); copied++) {
+		const PlannedMove&      plan       = planned[copied];
+		DeviceMemoryAllocation* allocation = plan.allocation;
+		try {
+			move({ allocation, allocation->memory, allocation->offset, allocation->mappedData, plan.target->memory, plan.placed.offset, plan.mappedData, allocation->size });
+		} catch (...) {
+			error = std::current_exception();
+			break;
+		}
+	}
+
+	DeviceMemoryDefragmentation result;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		for (std::size_t i = 0; i < planned.size(); i++) {
+			PlannedMove&            plan       = planned[i];
+			DeviceMemoryAllocation* allocation = plan.allocation;
+			plan.target->pendingMoves--;
+			allocation->moving = false;
+			if (i >= copied || allocation->freed) {
+				plan.target->placement.Free(plan.placed.node);
+				if (allocation->freed) {
+					allocation->block->placement.Free(allocation->node);
+					Unlink(allocation->block->allocations, allocation);
+					delete allocation;
+				}
+				continue;
+			}
+
+			// every other link into the target left room for this one
+			allocation->block->placement.Free(allocation->node);
+			Unlink(allocation->block->allocations, allocation);
+			allocation->memory     = plan.target->memory;
+			allocation->offset     = plan.placed.offset;
+			allocation->mappedData = plan.mappedData;
+			allocation->block      = plan.target;
+			allocation->node       = plan.placed.node;
+			Link(plan.target->allocations, allocation);
+
+			result.movedAllocations++;
+			result.movedBytes += allocation->size;
+		}
+
+		for (Pool& pool : this->pools) {
+			for (std::size_t i = pool.blocks.size(); i-- > 0;) {
+				if (pool.blocks[i]->placement.IsEmpty()) {
+					result.freedBlocks++;
+					result.freedBytes += pool.blocks[i]->placement.GetSize();
+					this->DestroyBlock(*pool.blocks[i]);
+				}
+			}
+		}
+	}
+
+	if (error) std::rethrow_exception(error);
+	return result;
+}
+
+std::vector<DeviceMemoryStatistics> DeviceMemoryAllocator::GetStatistics() const {
+	std::vector<DeviceMemoryStatistics> statistics;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		statistics = this->statistics;
+	}
+	for (std::uint32_t heap = 0; heap < statistics.size(); heap++) {
+		DeviceMemoryBudget budget = this->backend.GetBudget(heap);
+		statistics[heap].usage    = budget.usage;
+		statistics[heap].budget   = budget.budget;
+	}
+	return statistics;
+}
+
+DeviceMemoryBackend& DeviceMemoryAllocator::GetBackend() const noexcept {
+	return this->backend;
+}
+
+void DeviceMemoryAllocator::Link(std::vector<DeviceMemoryAllocation*>& list, DeviceMemoryAllocation* allocation) noexcept {
+	// ReserveLink() made room, so this never allocates
+	allocation->index = list.size();
+	list.push_back(allocation);
+}
+
+void DeviceMemoryAllocator::Unlink(std::vector<DeviceMemoryAllocation*>& list, DeviceMemoryAllocation* allocation) noexcept {
+	list[allocation->index]        = list.back();
+	list[allocation->index]->index = allocation->index;
+	list.pop_back();
+}
+
+void DeviceMemoryAllocator::ReserveLink(std::vector<DeviceMemoryAllocation*>& list, std::size_t pending) {
+	// keep room for the pending links of Defragment() as well
+	if (list.capacity() < list.size() + pending + 1) list.reserve(std::max(list.size() * 2 + 4, list.size() + pending + 1));
+}
+
+DeviceMemoryAllocation* DeviceMemoryAllocator::AllocateFromType(std::uint32_t memoryType, const DeviceMemoryRequest& request) {
+	std::uint64_t blockSize = this->blockSizes[this->types[memoryType].heapIndex];
+	if (request.dedicated || request.size > blockSize / 2) return this->AllocateDedicated(memoryType, request);
+
+	std::size_t pool = memoryType * 2 + (this->separateImages && request.optimalImage ? 1 : 0);
+	for (std::unique_ptr<Block>& block : this->pools[pool].blocks) {
+		if (block->placement.GetFreeSize() < request.size) continue;
+		if (DeviceMemoryAllocation* allocation = this->AllocateFromBlock(*block, request)) return allocation;
+	}
+
+	// may throw ExDeviceMemory
+	Block& block = this->CreateBlock(pool, memoryType, blockSize, request.size);
+
+	// offset 0 of an empty block fits any alignment
+	return this->AllocateFromBlock(block, request);
+}
+
+DeviceMemoryAllocation* DeviceMemoryAllocator::AllocateDedicated(std::uint32_t memoryType, const DeviceMemoryRequest& request) {
+	if (request.size > this->GetAvailableBudget(memoryType)) throw ExDeviceMemory("Allocation exceeds the memory budget.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), request.size);
+
+	ReserveLink(this->dedicated);
+	std::unique_ptr<DeviceMemoryAllocation> allocation(new DeviceMemoryAllocation());
+
+	// may throw ExDeviceMemory
+	allocation->memory     = this->AllocateMemory(memoryType, request.size, allocation->mappedData);
+	allocation->size       = request.size;
+	allocation->alignment  = request.alignment;
+	allocation->memoryType = memoryType;
+	allocation->userData   = request.userData;
+	Link(this->dedicated, allocation.get());
+
+	DeviceMemoryStatistics& statistics  = this->statistics[this->types[memoryType].heapIndex];
+	statistics.allocationCount++;
+	statistics.allocationBytes         += request.size;
+	return allocation.release();
+}
+
+DeviceMemoryAllocation* DeviceMemoryAllocator::AllocateFromBlock(Block& block, const DeviceMemoryRequest& request) {
+	ReserveLink(block.allocations, block.pendingMoves);
+	std::unique_ptr<DeviceMemoryAllocation> allocation(new DeviceMemoryAllocation());
+
+	TlsfAllocator::Allocation placed = block.placement.Allocate(request.size, request.alignment);
+	if (placed.node == TlsfAllocator::INVALID_NODE) return nullptr;
+
+	allocation->memory     = block.memory;
+	allocation->offset     = placed.offset;
+	allocation->size       = request.size;
+	allocation->alignment  = request.alignment;
+	allocation->memoryType = block.memoryType;
+	allocation->mappedData = block.mappedData != nullptr ? block.mappedData + placed.offset : nullptr;
+	allocation->userData   = request.userData;
+	allocation->block      = &block;
+	allocation->node       = placed.node;
+	Link(block.allocations, allocation.get());
+
+	DeviceMemoryStatistics& statistics  = this->statistics[this->types[block.memoryType].heapIndex];
+	statistics.allocationCount++;
+	statistics.allocationBytes         += request.size;
+	return allocation.release();
+}
+
+DeviceMemoryAllocator::Block& DeviceMemoryAllocator::CreateBlock(std::size_t pool, std::uint32_t memoryType, std::uint64_t size, std::uint64_t minSize) {
+	// use smaller blocks when the budget or the device memory runs low
+	std::uint64_t available = this->GetAvailableBudget(memoryType);
+	while (size > available && size / 2 >= minSize) size /= 2;
+	if (size > available) throw ExDeviceMemory("Allocation exceeds the memory budget.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), minSize);
+
+	DeviceMemoryHandle memory;
+	std::byte*         mappedData;
+	while (true) {
+		try {
+			memory = this->AllocateMemory(memoryType, size, mappedData);
+			break;
+		} catch (const ExDeviceMemory&) {
+			if (size / 2 < minSize) throw;
+			size /= 2;
+		}
+	}
+
+	try {
+		this->pools[pool].blocks.push_back(std::make_unique<Block>(Block { memory, memoryType, pool, mappedData, TlsfAllocator(size), {} }));
+	} catch (...) {
+		this->FreeMemory(memory, memoryType, size, mappedData != nullptr);
+		throw;
+	}
+	return *this->pools[pool].blocks.back();
+}
+
+void DeviceMemoryAllocator::DestroyBlock(Block& block) noexcept {
+	std::vector<std::unique_ptr<Block>>& blocks = this->pools[block.pool].blocks;
+	for (std::size_t i = 0; i < blocks.size(); i++) {
+		if (blocks[i].get() == &block) {
+			this->FreeMemory(block.memory, block.memoryType, block.placement.GetSize(), block.mappedData != nullptr);
+			blocks.erase(blocks.begin() + static_cast<std::ptrdiff_t>(i));
+			return;
+		}
+	}
+}
+
+std::uint64_t DeviceMemoryAllocator::GetAvailableBudget(std::uint32_t memoryType) const noexcept {
+	DeviceMemoryBudget budget = this->backend.GetBudget(this->types[memoryType].heapIndex);
+	return budget.budget > budget.usage ? budget.budget - budget.usage : 0;
+}
+
+DeviceMemoryHandle DeviceMemoryAllocator::AllocateMemory(std::uint32_t memoryType, std::uint64_t size, std::byte*& mappedData) {
+	// may throw ExDeviceMemory
+	DeviceMemoryHandle memory = this->backend.Allocate(memoryType, size);
+
+	mappedData = nullptr;
+	if (this->types[memoryType].flags & DeviceMemoryProperty::HOST_VISIBLE) {
+		try {
+			mappedData = static_cast<std::byte*>(this->backend.Map(memory));
+		} catch (...) {
+			this->backend.Free(memory);
+			throw;
+		}
+	}
+
+	DeviceMemoryStatistics& statistics  = this->statistics[this->types[memoryType].heapIndex];
+	statistics.blockCount++;
+	statistics.blockBytes              += size;
+	return memory;
+}
+
+void DeviceMemoryAllocator::FreeMemory(DeviceMemoryHandle memory, std::uint32_t memoryType, std::uint64_t size, bool mapped) noexcept {
+	if (mapped) this->backend.Unmap(memory);
+	this->backend.Free(memory);
+
+	DeviceMemoryStatistics& statistics  = this->statistics[this->types[memoryType].heapIndex];
+	statistics.blockCount--;
+	statistics.blockBytes              -= size;
+}
+
+DeviceMemoryHandle DeviceMemoryAllocation::GetMemory() const noexcept {
+	return this->memory;
+}
+
+std::uint64_t DeviceMemoryAllocation::GetOffset() const noexcept {
+	return this->offset;
+}
+
+std::uint64_t DeviceMemoryAllocation::GetSize() const noexcept {
+	return this->size;
+}
+
+std::uint32_t DeviceMemoryAllocation::GetMemoryType() const noexcept {
+	return this->memoryType;
+}
+
+void* DeviceMemoryAllocation::GetMappedData() const noexcept {
+	return this->mappedData;
+}
+
+bool DeviceMemoryAllocation::IsDedicated() const noexcept {
+	return this->block == nullptr;
+}
+
+void* DeviceMemoryAllocation::GetUserData() const noexcept {
+	return this->userData;
+}
+
+void DeviceMemoryAllocation::SetUserData(void* userData) noexcept {
+	this->userData = userData;
+}
+
+} // namespace Junia
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * @file      DeviceMemoryRingBuffer.cpp
+ * @brief     Contains the class implementation for linear and ring allocation
+ *            of per-frame upload memory
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Graphics/DeviceMemoryRingBuffer.hpp>
+
+#include <bit>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Graphics/DeviceMemoryRingBuffer.cpp";
+
+namespace Junia {
+
+DeviceMemoryRingBuffer::DeviceMemoryRingBuffer(DeviceMemoryAllocator& allocator, std::uint64_t size, std::uint32_t memoryTypeBits, std::uint32_t preferredFlags)
+	: allocator(allocator), size(size), head(0), tail(0), used(0), frameSize(0) {
+	DeviceMemoryRequest request;
+	request.size           = size;
+	request.memoryTypeBits = memoryTypeBits;
+	request.requiredFlags  = DeviceMemoryProperty::HOST_VISIBLE | DeviceMemoryProperty::HOST_COHERENT;
+	request.preferredFlags = preferredFlags;
+	request.dedicated      = true;
+
+	// may throw ExDeviceMemory
+	this->allocation = allocator.Allocate(request);
+	this->data       = static_cast<std::byte*>(this->allocation->GetMappedData());
+}
+
+DeviceMemoryRingBuffer::~DeviceMemoryRingBuffer() {
+	this->allocator.Free(this->allocation);
+}
+
+DeviceMemorySlice DeviceMemoryRingBuffer::Allocate(std::uint64_t size, std::uint64_t alignment) {
+	if (size == 0) throw ExInvalidArgument("Allocation size is 0.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "size");
+	if (!std::has_single_bit(alignment)) throw ExInvalidArgument("Alignment is not a power of two.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "alignment");
+
+	// start over at the front once every frame was released
+	if (this->used == 0 && this->frames.empty()) this->head = this->tail = 0;
+
+	std::uint64_t offset = (this->head + alignment - 1) & ~(alignment - 1);
+	std::uint64_t end    = 0;
+	if (this->used == 0 || this->head > this->tail) {
+		// the free space is behind the head and in front of the tail
+		if (offset >= this->head && offset <= this->size && size <= this->size - offset) end = offset + size;
+		else if (size <= this->tail) {
+			offset = 0;
+			end    = size;
+		}
+	} else if (offset <= this->tail && size <= this->tail - offset) {
+		end = offset + size;
+	}
+	if (end == 0) throw ExDeviceMemory("Ring buffer is full.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size);
+
+	// skipped bytes at the end of the buffer belong to this frame as well
+	std::uint64_t consumed  = end > this->head ? end - this->head : this->size - this->head + end;
+	this->used             += consumed;
+	this->frameSize        += consumed;
+	this->head              = end == this->size ? 0 : end;
+	return { this->allocation->GetMemory(), this->allocation->GetOffset() + offset, this->data + offset };
+}
+
+void DeviceMemoryRingBuffer::EndFrame() {
+	this->frames.push_back({ this->head, this->frameSize });
+	this->frameSize = 0;
+}
+
+bool DeviceMemoryRingBuffer::ReleaseFrame() noexcept {
+	if (this->frames.empty()) return false;
+
+	Frame frame = this->frames.front();
+	this->frames.pop_front();
+	this->tail  = frame.end;
+	this->used -= frame.size;
+	return true;
+}
+
+void DeviceMemoryRingBuffer::Reset() noexcept {
+	this->frames.clear();
+	this->head      = 0;
+	this->tail      = 0;
+	this->used      = 0;
+	this->frameSize = 0;
+}
+
+const DeviceMemoryAllocation& DeviceMemoryRingBuffer::GetAllocation() const noexcept {
+	return *this->allocation;
+}
+
+std::uint64_t DeviceMemoryRingBuffer::GetSize() const noexcept {
+	return this->size;
+}
+
+std::uint64_t DeviceMemoryRingBuffer::GetUsedSize() const noexcept {
+	return this->used;
+}
+
+} // namespace Junia
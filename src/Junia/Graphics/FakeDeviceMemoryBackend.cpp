@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * @file      FakeDeviceMemoryBackend.cpp
+ * @brief     Contains the class implementation for the in-process device
+ *            memory backend used to test the DeviceMemoryAllocator without a
+ *            GPU
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Graphics/FakeDeviceMemoryBackend.hpp>
+
+#include <new>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Graphics/FakeDeviceMemoryBackend.cpp";
+
+namespace Junia {
+
+static constexpr std::uint64_t GiB = 1024ull * 1024 * 1024;
+
+FakeDeviceMemoryBackend::FakeDeviceMemoryBackend()
+	: FakeDeviceMemoryBackend(
+		  {
+			  { DeviceMemoryProperty::DEVICE_LOCAL, 0 },
+			  { DeviceMemoryProperty::HOST_VISIBLE | DeviceMemoryProperty::HOST_COHERENT, 1 },
+			  { DeviceMemoryProperty::HOST_VISIBLE | DeviceMemoryProperty::HOST_COHERENT | DeviceMemoryProperty::HOST_CACHED, 1 },
+			  { DeviceMemoryProperty::DEVICE_LOCAL | DeviceMemoryProperty::HOST_VISIBLE | DeviceMemoryProperty::HOST_COHERENT, 0 },
+		  },
+		  {
+			  { 8 * GiB, true },
+			  { 16 * GiB, false },
+		  },
+		  1024) { }
+
+FakeDeviceMemoryBackend::FakeDeviceMemoryBackend(std::vector<DeviceMemoryType> types, std::vector<DeviceMemoryHeap> heaps, std::uint64_t bufferImageGranularity, std::uint32_t maxAllocationCount)
+	: types(std::move(types)), heaps(std::move(heaps)), bufferImageGranularity(bufferImageGranularity), maxAllocationCount(maxAllocationCount),
+	  heapUsage(this->heaps.size(), 0), nextHandle(1), failures(0), totalAllocations(0), misuses(0) {
+	for (const DeviceMemoryHeap& heap : this->heaps) this->heapBudgets.push_back(heap.size);
+}
+
+std::span<const DeviceMemoryType> FakeDeviceMemoryBackend::GetMemoryTypes() const noexcept {
+	return this->types;
+}
+
+std::span<const DeviceMemoryHeap> FakeDeviceMemoryBackend::GetMemoryHeaps() const noexcept {
+	return this->heaps;
+}
+
+std::uint64_t FakeDeviceMemoryBackend::GetBufferImageGranularity() const noexcept {
+	return this->bufferImageGranularity;
+}
+
+DeviceMemoryBudget FakeDeviceMemoryBackend::GetBudget(std::uint32_t heap) const noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return { this->heapUsage[heap], this->heapBudgets[heap] };
+}
+
+DeviceMemoryHandle FakeDeviceMemoryBackend::Allocate(std::uint32_t memoryType, std::uint64_t size) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	std::uint32_t               heap = this->types.at(memoryType).heapIndex;
+
+	if (this->failures > 0) {
+		this->failures--;
+		throw ExDeviceMemory("Simulated out of device memory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size);
+	}
+	if (this->allocations.size() >= this->maxAllocationCount) throw ExDeviceMemory("Too many device memory allocations.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size);
+	if (size == 0 || size > this->heaps[heap].size - this->heapUsage[heap]) throw ExDeviceMemory("Out of device memory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size);
+
+	DeviceMemoryHandle handle = this->nextHandle++;
+	this->allocations.emplace(handle, Memory { memoryType, size, nullptr, false });
+	this->heapUsage[heap] += size;
+	this->totalAllocations++;
+	return handle;
+}
+
+void FakeDeviceMemoryBackend::Free(DeviceMemoryHandle memory) noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto it = this->allocations.find(memory);
+	if (it == this->allocations.end() || it->second.mapped) {
+		this->misuses++;
+		return;
+	}
+	this->heapUsage[this->types[it->second.memoryType].heapIndex] -= it->second.size;
+	this->allocations.erase(it);
+}
+
+void* FakeDeviceMemoryBackend::Map(DeviceMemoryHandle memory) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto it = this->allocations.find(memory);
+	if (it == this->allocations.end()) throw ExDeviceMemory("Unknown device memory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), 0);
+	Memory& allocation = it->second;
+	if (!(this->types[allocation.memoryType].flags & DeviceMemoryProperty::HOST_VISIBLE)) throw ExDeviceMemory("Device memory is not host visible.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), allocation.size);
+	if (allocation.mapped) throw ExDeviceMemory("Device memory is already mapped.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), allocation.size);
+
+	if (!allocation.data) {
+		allocation.data = std::unique_ptr<std::byte[]>(new (std::nothrow) std::byte[allocation.size]);
+		if (!allocation.data) throw ExDeviceMemory("Failed to back device memory with host memory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), allocation.size);
+	}
+	allocation.mapped = true;
+	return allocation.data.get();
+}
+
+void FakeDeviceMemoryBackend::Unmap(DeviceMemoryHandle memory) noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto it = this->allocations.find(memory);
+	if (it == this->allocations.end() || !it->second.mapped) {
+		this->misuses++;
+		return;
+	}
+	it->second.mapped = false;
+}
+
+void FakeDeviceMemoryBackend::SetBudget(std::uint32_t heap, std::uint64_t budget) noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->heapBudgets[heap] = budget;
+}
+
+void FakeDeviceMemoryBackend::FailNextAllocations(std::uint32_t count) noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->failures = count;
+}
+
+std::uint32_t FakeDeviceMemoryBackend::GetAllocationCount() const noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return static_cast<std::uint32_t>(this->allocations.size());
+}
+
+std::uint64_t FakeDeviceMemoryBackend::GetTotalAllocationCount() const noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->totalAllocations;
+}
+
+std::uint64_t FakeDeviceMemoryBackend::GetMisuseCount() const noexcept {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->misuses;
+}
+
+} // namespace Junia
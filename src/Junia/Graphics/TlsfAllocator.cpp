@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * @file      TlsfAllocator.cpp
+ * @brief     Contains the class implementation for the two-level segregated
+ *            fit placement allocator
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Graphics/TlsfAllocator.hpp>
+
+#include <bit>
+#include <limits>
+
+namespace Junia {
+
+TlsfAllocator::TlsfAllocator(std::uint64_t size)
+	: size(size), freeSize(size), allocationCount(0), flBitmap(0), slBitmaps {} {
+	for (std::array<std::uint32_t, SL_COUNT>& lists : this->freeLists) lists.fill(INVALID_NODE);
+	this->nodes.reserve(16);
+	this->unusedNodes.reserve(16);
+	if (size > 0) this->InsertFree(this->CreateNode(0, size));
+}
+
+TlsfAllocator::Allocation TlsfAllocator::Allocate(std::uint64_t size, std::uint64_t alignment) {
+	// any free range of this size can hold the allocation after aligning it
+	std::uint64_t padding = alignment - 1;
+	if (size == 0 || size > this->freeSize || size > std::numeric_limits<std::uint64_t>::max() - padding) return { 0, INVALID_NODE };
+
+	std::uint32_t node = this->FindFree(size + padding);
+	if (node == INVALID_NODE) node = this->FindFit(size, alignment);
+	if (node == INVALID_NODE) return { 0, INVALID_NODE };
+
+	// reserve the nodes for splitting up front, so running out of memory
+	// cannot leave the free lists in an inconsistent state
+	if (this->nodes.capacity() < this->nodes.size() + 2) this->nodes.reserve(this->nodes.size() * 2 + 2);
+	if (this->unusedNodes.capacity() < this->nodes.capacity()) this->unusedNodes.reserve(this->nodes.capacity());
+	this->RemoveFree(node);
+
+	std::uint64_t offset  = this->nodes[node].offset;
+	std::uint64_t aligned = (offset + padding) & ~padding;
+
+	// the physical neighbours of a free range are never free, so the split
+	// ranges do not need to be merged
+	if (aligned != offset) {
+		std::uint32_t front                 = this->CreateNode(offset, aligned - offset);
+		this->nodes[front].prevPhysical     = this->nodes[node].prevPhysical;
+		this->nodes[front].nextPhysical     = node;
+		if (this->nodes[node].prevPhysical != INVALID_NODE) this->nodes[this->nodes[node].prevPhysical].nextPhysical = front;
+		this->nodes[node].prevPhysical      = front;
+		this->nodes[node].offset            = aligned;
+		this->nodes[node].size             -= aligned - offset;
+		this->InsertFree(front);
+	}
+	if (this->nodes[node].size > size) {
+		std::uint32_t back              = this->CreateNode(aligned + size, this->nodes[node].size - size);
+		this->nodes[back].prevPhysical  = node;
+		this->nodes[back].nextPhysical  = this->nodes[node].nextPhysical;
+		if (this->nodes[node].nextPhysical != INVALID_NODE) this->nodes[this->nodes[node].nextPhysical].prevPhysical = back;
+		this->nodes[node].nextPhysical  = back;
+		this->nodes[node].size          = size;
+		this->InsertFree(back);
+	}
+
+	this->nodes[node].free  = false;
+	this->freeSize         -= size;
+	this->allocationCount++;
+	return { aligned, node };
+}
+
+void TlsfAllocator::Free(std::uint32_t node) noexcept {
+	this->freeSize += this->nodes[node].size;
+	this->allocationCount--;
+
+	std::uint32_t prev = this->nodes[node].prevPhysical;
+	if (prev != INVALID_NODE && this->nodes[prev].free) {
+		this->RemoveFree(prev);
+		this->nodes[prev].size         += this->nodes[node].size;
+		this->nodes[prev].nextPhysical  = this->nodes[node].nextPhysical;
+		if (this->nodes[node].nextPhysical != INVALID_NODE) this->nodes[this->nodes[node].nextPhysical].prevPhysical = prev;
+		this->DestroyNode(node);
+		node = prev;
+	}
+
+	std::uint32_t next = this->nodes[node].nextPhysical;
+	if (next != INVALID_NODE && this->nodes[next].free) {
+		this->RemoveFree(next);
+		this->nodes[node].size         += this->nodes[next].size;
+		this->nodes[node].nextPhysical  = this->nodes[next].nextPhysical;
+		if (this->nodes[next].nextPhysical != INVALID_NODE) this->nodes[this->nodes[next].nextPhysical].prevPhysical = node;
+		this->DestroyNode(next);
+	}
+
+	this->InsertFree(node);
+}
+
+std::uint64_t TlsfAllocator::GetSize() const noexcept {
+	return this->size;
+}
+
+std::uint64_t TlsfAllocator::GetFreeSize() const noexcept {
+	return this->freeSize;
+}
+
+std::uint32_t TlsfAllocator::GetAllocationCount() const noexcept {
+	return this->allocationCount;
+}
+
+bool TlsfAllocator::IsEmpty() const noexcept {
+	return this->allocationCount == 0;
+}
+
+void TlsfAllocator::Mapping(std::uint64_t size, std::uint32_t& fl, std::uint32_t& sl) noexcept {
+	if (size < SL_COUNT) {
+		fl = 0;
+		sl = static_cast<std::uint32_t>(size);
+	} else {
+		std::uint32_t log = static_cast<std::uint32_t>(std::bit_width(size)) - 1;
+		fl                = log - SL_BITS + 1;
+		sl                = static_cast<std::uint32_t>(size >> (log - SL_BITS)) - SL_COUNT;
+	}
+}
+
+std::uint32_t TlsfAllocator::FindFree(std::uint64_t size) const noexcept {
+	// round up to the next size class, so every range in the class is large
+	// enough
+	if (size >= SL_COUNT) {
+		std::uint64_t round = (std::uint64_t(1) << (std::bit_width(size) - 1 - SL_BITS)) - 1;
+		if (size > std::numeric_limits<std::uint64_t>::max() - round) return INVALID_NODE;
+		size += round;
+	}
+
+	std::uint32_t fl, sl;
+	Mapping(size, fl, sl);
+
+	std::uint32_t slMap = this->slBitmaps[fl] & (~std::uint32_t(0) << sl);
+	if (slMap == 0) {
+		std::uint64_t flMap = this->flBitmap & (~std::uint64_t(0) << (fl + 1));
+		if (flMap == 0) return INVALID_NODE;
+		fl    = static_cast<std::uint32_t>(std::countr_zero(flMap));
+		slMap = this->slBitmaps[fl];
+	}
+	sl = static_cast<std::uint32_t>(std::countr_zero(slMap));
+	return this->freeLists[fl][sl];
+}
+
+std::uint32_t TlsfAllocator::FindFit(std::uint64_t size, std::uint64_t alignment) const noexcept {
+	// the size classes that FindFree() skipped by rounding up may still
+	// contain a range that fits, e.g. one of exactly the requested size. The
+	// search gives up after MAX_FIT_STEPS classes and ranges, so allocation
+	// stays constant time at the cost of occasionally missing a fit.
+	std::uint32_t fl, sl, lastFl, lastSl;
+	Mapping(size, fl, sl);
+	Mapping(size + alignment - 1, lastFl, lastSl);
+
+	std::uint32_t steps = 0;
+	while (fl < lastFl || (fl == lastFl && sl <= lastSl)) {
+		if (++steps > MAX_FIT_STEPS) return INVALID_NODE;
+		for (std::uint32_t node = this->freeLists[fl][sl]; node != INVALID_NODE; node = this->nodes[node].nextFree) {
+			if (++steps > MAX_FIT_STEPS) return INVALID_NODE;
+			const Node&   n       = this->nodes[node];
+			std::uint64_t padding = ((n.offset + alignment - 1) & ~(alignment - 1)) - n.offset;
+			if (n.size >= size && padding <= n.size - size) return node;
+		}
+		if (++sl == SL_COUNT) {
+			sl = 0;
+			fl++;
+		}
+	}
+	return INVALID_NODE;
+}
+
+std::uint32_t TlsfAllocator::CreateNode(std::uint64_t offset, std::uint64_t size) noexcept {
+	Node node { offset, size, INVALID_NODE, INVALID_NODE, INVALID_NODE, INVALID_NODE, false };
+	if (!this->unusedNodes.empty()) {
+		std::uint32_t index = this->unusedNodes.back();
+		this->unusedNodes.pop_back();
+		this->nodes[index] = node;
+		return index;
+	}
+	this->nodes.push_back(node);
+	return static_cast<std::uint32_t>(this->nodes.size() - 1);
+}
+
+void TlsfAllocator::DestroyNode(std::uint32_t node) noexcept {
+	// Allocate() reserved room for every node, so this never allocates
+	this->unusedNodes.push_back(node);
+}
+
+void TlsfAllocator::InsertFree(std::uint32_t node) noexcept {
+	std::uint32_t fl, sl;
+	Mapping(this->nodes[node].size, fl, sl);
+
+	std::uint32_t head            = this->freeLists[fl][sl];
+	this->nodes[node].free        = true;
+	this->nodes[node].prevFree    = INVALID_NODE;
+	this->nodes[node].nextFree    = head;
+	if (head != INVALID_NODE) this->nodes[head].prevFree = node;
+	this->freeLists[fl][sl]       = node;
+	this->slBitmaps[fl]          |= std::uint32_t(1) << sl;
+	this->flBitmap               |= std::uint64_t(1) << fl;
+}
+
+void TlsfAllocator::RemoveFree(std::uint32_t node) noexcept {
+	std::uint32_t fl, sl;
+	Mapping(this->nodes[node].size, fl, sl);
+
+	const Node& n = this->nodes[node];
+	if (n.prevFree != INVALID_NODE) this->nodes[n.prevFree].nextFree = n.nextFree;
+	else this->freeLists[fl][sl] = n.nextFree;
+	if (n.nextFree != INVALID_NODE) this->nodes[n.nextFree].prevFree = n.prevFree;
+
+	if (this->freeLists[fl][sl] == INVALID_NODE) {
+		this->slBitmaps[fl] &= ~(std::uint32_t(1) << sl);
+		if (this->slBitmaps[fl] == 0) this->flBitmap &= ~(std::uint64_t(1) << fl);
+	}
+	this->nodes[node].free = false;
+}
+
+} // namespace Junia
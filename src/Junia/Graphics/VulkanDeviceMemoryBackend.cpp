@@ -0,0 +1,136 @@
+/*******************************************************************************
+ *
+ * @file      VulkanDeviceMemoryBackend.cpp
+ * @brief     Contains the class implementation for allocating device memory
+ *            with Vulkan
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Graphics/VulkanDeviceMemoryBackend.hpp>
+
+#include <algorithm>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Graphics/VulkanDeviceMemoryBackend.cpp";
+
+namespace Junia {
+
+VulkanDeviceMemoryBackend::VulkanDeviceMemoryBackend(VkPhysicalDevice physicalDevice, VkDevice device, bool memoryBudget)
+	: physicalDevice(physicalDevice), device(device), memoryBudget(memoryBudget) {
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+	this->maxAllocationCount     = properties.limits.maxMemoryAllocationCount;
+	this->bufferImageGranularity = properties.limits.bufferImageGranularity;
+
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+	for (std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+		this->types.push_back({ memoryProperties.memoryTypes[i].propertyFlags, memoryProperties.memoryTypes[i].heapIndex });
+	for (std::uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++)
+		this->heaps.push_back({ memoryProperties.memoryHeaps[i].size, (memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0 });
+	this->heapUsage.resize(this->heaps.size(), 0);
+}
+
+std::span<const DeviceMemoryType> VulkanDeviceMemoryBackend::GetMemoryTypes() const noexcept {
+	return this->types;
+}
+
+std::span<const DeviceMemoryHeap> VulkanDeviceMemoryBackend::GetMemoryHeaps() const noexcept {
+	return this->heaps;
+}
+
+std::uint64_t VulkanDeviceMemoryBackend::GetBufferImageGranularity() const noexcept {
+	return this->bufferImageGranularity;
+}
+
+DeviceMemoryBudget VulkanDeviceMemoryBackend::GetBudget(std::uint32_t heap) const noexcept {
+	if (this->memoryBudget) {
+		VkPhysicalDeviceMemoryBudgetPropertiesEXT budget {};
+		budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+		VkPhysicalDeviceMemoryProperties2 properties {};
+		properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+		properties.pNext = &budget;
+		vkGetPhysicalDeviceMemoryProperties2(this->physicalDevice, &properties);
+		return { budget.heapUsage[heap], std::min(budget.heapBudget[heap], this->heaps[heap].size) };
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return { this->heapUsage[heap], this->heaps[heap].size / 10 * 8 };
+}
+
+DeviceMemoryHandle VulkanDeviceMemoryBackend::Allocate(std::uint32_t memoryType, std::uint64_t size) {
+	std::uint32_t heap = this->types.at(memoryType).heapIndex;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->allocations.size() >= this->maxAllocationCount) throw ExDeviceMemory("Too many device memory allocations.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size);
+	}
+
+	VkMemoryAllocateInfo info {};
+	info.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	info.allocationSize  = size;
+	info.memoryTypeIndex = memoryType;
+
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	VkResult       result = vkAllocateMemory(this->device, &info, nullptr, &memory);
+	if (result != VK_SUCCESS) throw ExDeviceMemory(result == VK_ERROR_OUT_OF_HOST_MEMORY ? "Out of host memory." : "Out of device memory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), size);
+
+	DeviceMemoryHandle          handle = FromVulkan(memory);
+	std::lock_guard<std::mutex> lock(this->mutex);
+	try {
+		this->allocations.emplace(handle, Memory { heap, size });
+	} catch (...) {
+		vkFreeMemory(this->device, memory, nullptr);
+		throw;
+	}
+	this->heapUsage[heap] += size;
+	return handle;
+}
+
+void VulkanDeviceMemoryBackend::Free(DeviceMemoryHandle memory) noexcept {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto                        it = this->allocations.find(memory);
+		if (it == this->allocations.end()) return;
+		this->heapUsage[it->second.heap] -= it->second.size;
+		this->allocations.erase(it);
+	}
+	vkFreeMemory(this->device, ToVulkan(memory), nullptr);
+}
+
+void* VulkanDeviceMemoryBackend::Map(DeviceMemoryHandle memory) {
+	void*    data   = nullptr;
+	VkResult result = vkMapMemory(this->device, ToVulkan(memory), 0, VK_WHOLE_SIZE, 0, &data);
+	if (result != VK_SUCCESS) throw ExDeviceMemory("Failed to map device memory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), 0);
+	return data;
+}
+
+void VulkanDeviceMemoryBackend::Unmap(DeviceMemoryHandle memory) noexcept {
+	vkUnmapMemory(this->device, ToVulkan(memory));
+}
+
+// non-dispatchable handles are pointers on 64-bit platforms only
+#if VK_USE_64_BIT_PTR_DEFINES == 1
+
+VkDeviceMemory VulkanDeviceMemoryBackend::ToVulkan(DeviceMemoryHandle memory) noexcept {
+	return reinterpret_cast<VkDeviceMemory>(static_cast<std::uintptr_t>(memory));
+}
+
+DeviceMemoryHandle VulkanDeviceMemoryBackend::FromVulkan(VkDeviceMemory memory) noexcept {
+	return static_cast<DeviceMemoryHandle>(reinterpret_cast<std::uintptr_t>(memory));
+}
+
+#else
+
+VkDeviceMemory VulkanDeviceMemoryBackend::ToVulkan(DeviceMemoryHandle memory) noexcept {
+	return static_cast<VkDeviceMemory>(memory);
+}
+
+DeviceMemoryHandle VulkanDeviceMemoryBackend::FromVulkan(VkDeviceMemory memory) noexcept {
+	return static_cast<DeviceMemoryHandle>(memory);
+}
+
+#endif
+
+} // namespace Junia
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * @file      AssetPack.cpp
+ * @brief     Contains the class implementation for reading asset packs
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/AssetPack.hpp>
+
+#include <Junia/Core/Hash.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+static_assert(std::endian::native == std::endian::little, "Asset packs are mapped in place and require a little-endian target.");
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/IO/AssetPack.cpp";
+
+namespace Junia {
+
+namespace {
+
+bool InRange(std::uint64_t offset, std::uint64_t size, std::uint64_t total) noexcept {
+	return offset <= total && size <= total - offset;
+}
+
+bool EntryLess(const AssetPackEntry& a, std::uint64_t hash, std::string_view pathA, std::string_view pathB) noexcept {
+	return a.pathHash < hash || (a.pathHash == hash && pathA < pathB);
+}
+
+} // namespace
+
+AssetPack::AssetPack(const utf8_string& path) : filePath(path), file(path) {
+	std::span<const std::byte> data = this->file.GetData();
+
+	if (data.size() < sizeof(AssetPackHeader)) throw ExAssetPack("File is too small to be an asset pack.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	const AssetPackHeader* header = reinterpret_cast<const AssetPackHeader*>(data.data());
+
+	if (std::memcmp(header->magic, AssetPackHeader::MAGIC, sizeof(header->magic)) != 0) throw ExAssetPack("File is not an asset pack.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	if (header->version != AssetPackHeader::VERSION) throw ExAssetPack("Unsupported asset pack version.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	if (header->fileSize != data.size()) throw ExAssetPack("Asset pack is truncated.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+
+	std::uint64_t tocSize = static_cast<std::uint64_t>(header->entryCount) * sizeof(AssetPackEntry);
+	if (header->tocOffset % alignof(AssetPackEntry) != 0 || !InRange(header->tocOffset, tocSize, data.size()))
+		throw ExAssetPack("Invalid asset pack table of contents.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	if (!InRange(header->pathsOffset, header->pathsSize, data.size()))
+		throw ExAssetPack("Invalid asset pack path table.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+
+	this->entries = std::span<const AssetPackEntry>(reinterpret_cast<const AssetPackEntry*>(data.data() + header->tocOffset), header->entryCount);
+	this->paths   = std::string_view(reinterpret_cast<const char*>(data.data() + header->pathsOffset), header->pathsSize);
+
+	// validate every entry once so lookups do not need any bounds checks
+	for (std::size_t i = 0; i < this->entries.size(); i++) {
+		const AssetPackEntry& entry = this->entries[i];
+		if (!InRange(entry.pathOffset, entry.pathLength, this->paths.size()) || !InRange(entry.dataOffset, entry.storedSize, data.size()))
+			throw ExAssetPack("Asset pack entry is out of bounds.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+		if (!entry.IsCompressed() && entry.storedSize != entry.size)
+			throw ExAssetPack("Asset pack entry has an invalid size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+		// LZ4 expands data by at most a factor of 255, so larger sizes are corrupt
+		if (entry.IsCompressed() && entry.size > entry.storedSize * 255 + 16)
+			throw ExAssetPack("Asset pack entry has an invalid size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+		if (i > 0 && !EntryLess(this->entries[i - 1], entry.pathHash, this->GetPath(this->entries[i - 1]), this->GetPath(entry)))
+			throw ExAssetPack("Asset pack table of contents is not sorted.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	}
+}
+
+const AssetPackEntry* AssetPack::Find(std::string_view normalizedPath) const noexcept {
+	std::uint64_t hash = HashFNV1a64(normalizedPath);
+
+	auto it = std::lower_bound(this->entries.begin(), this->entries.end(), hash, [](const AssetPackEntry& entry, std::uint64_t hash) {
+		return entry.pathHash < hash;
+	});
+	for (; it != this->entries.end() && it->pathHash == hash; ++it)
+		if (this->GetPath(*it) == normalizedPath) return &*it;
+
+	return nullptr;
+}
+
+std::span<const AssetPackEntry> AssetPack::GetEntries() const noexcept {
+	return this->entries;
+}
+
+std::string_view AssetPack::GetPath(const AssetPackEntry& entry) const noexcept {
+	return this->paths.substr(entry.pathOffset, entry.pathLength);
+}
+
+std::span<const std::byte> AssetPack::GetStoredData(const AssetPackEntry& entry) const noexcept {
+	return this->file.GetData().subspan(entry.dataOffset, entry.storedSize);
+}
+
+const MappedFile& AssetPack::GetFile() const noexcept {
+	return this->file;
+}
+
+const utf8_string& AssetPack::GetFilePath() const noexcept {
+	return this->filePath;
+}
+
+} // namespace Junia
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * @file      AssetPackWriter.cpp
+ * @brief     Contains the class implementation for creating asset packs
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/AssetPackWriter.hpp>
+
+#include <Junia/Core/Hash.hpp>
+#include <Junia/IO/Lz4.hpp>
+#include <Junia/IO/Path.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/IO/AssetPackWriter.cpp";
+
+namespace Junia {
+
+void AssetPackWriter::Add(const utf8_string& path, std::span<const std::byte> data, bool compress) {
+	this->assets.push_back({ Path::Normalize(path), "", std::vector<std::byte>(data.begin(), data.end()), compress });
+}
+
+void AssetPackWriter::AddFile(const utf8_string& path, const utf8_string& sourceFile, bool compress) {
+	this->assets.push_back({ Path::Normalize(path), sourceFile, {}, compress });
+}
+
+void AssetPackWriter::Write(const utf8_string& output) const {
+	// the table of contents is sorted by (hash, path) so the reader can binary
+	// search it
+	std::vector<const PendingAsset*> order;
+	std::vector<std::uint64_t>       hashes(this->assets.size());
+	for (std::size_t i = 0; i < this->assets.size(); i++) {
+		order.push_back(&this->assets[i]);
+		hashes[i] = HashFNV1a64(this->assets[i].path);
+	}
+	auto hashOf = [&](const PendingAsset* asset) { return hashes[asset - this->assets.data()]; };
+	std::sort(order.begin(), order.end(), [&](const PendingAsset* a, const PendingAsset* b) {
+		return hashOf(a) != hashOf(b) ? hashOf(a) < hashOf(b) : a->path < b->path;
+	});
+	for (std::size_t i = 1; i < order.size(); i++)
+		if (order[i - 1]->path == order[i]->path) throw ExAssetPack("Duplicate asset path.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), order[i]->path);
+
+	std::ofstream stream(Path::ToNative(output), std::ios::binary | std::ios::trunc);
+	if (!stream) throw ExFile("Failed to create asset pack.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), output);
+
+	std::uint64_t position = 0;
+
+	auto write = [&](const void* data, std::size_t size) {
+		stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+		position += size;
+	};
+	auto pad = [&](std::uint64_t alignment) {
+		static constexpr char zeros[16] = {};
+		write(zeros, (alignment - position % alignment) % alignment);
+	};
+
+	AssetPackHeader header {};
+	write(&header, sizeof(header));
+
+	std::vector<AssetPackEntry> entries;
+	utf8_string                 paths;
+	std::vector<std::byte>      compressed;
+	for (const PendingAsset* asset : order) {
+		MappedFile                 source;
+		std::span<const std::byte> data = asset->data;
+		if (!asset->sourceFile.empty()) {
+			source = MappedFile(asset->sourceFile);
+			data   = source.GetData();
+		}
+
+		if (paths.size() + asset->path.size() > std::numeric_limits<std::uint32_t>::max())
+			throw ExAssetPack("Asset pack path table is too large.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), asset->path);
+
+		AssetPackEntry entry {};
+		entry.pathHash   = HashFNV1a64(asset->path);
+		entry.pathOffset = static_cast<std::uint32_t>(paths.size());
+		entry.pathLength = static_cast<std::uint32_t>(asset->path.size());
+		entry.size       = data.size();
+		paths += asset->path;
+
+		if (asset->compress && !data.empty()) {
+			compressed.resize(Lz4::CompressBound(data.size()));
+			std::size_t compressedSize = Lz4::Compress(data, compressed);
+			if (compressedSize > 0 && compressedSize < data.size()) {
+				data = std::span<const std::byte>(compressed.data(), compressedSize);
+				entry.flags |= AssetPackEntry::FLAG_LZ4;
+			}
+		}
+
+		pad(AssetPackHeader::DATA_ALIGNMENT);
+		entry.dataOffset = position;
+		entry.storedSize = data.size();
+		write(data.data(), data.size());
+		entries.push_back(entry);
+	}
+
+	pad(alignof(AssetPackEntry));
+	std::memcpy(header.magic, AssetPackHeader::MAGIC, sizeof(header.magic));
+	header.version     = AssetPackHeader::VERSION;
+	header.entryCount  = static_cast<std::uint32_t>(entries.size());
+	header.tocOffset   = position;
+	header.pathsOffset = position + entries.size() * sizeof(AssetPackEntry);
+	header.pathsSize   = paths.size();
+	header.fileSize    = header.pathsOffset + header.pathsSize;
+	write(entries.data(), entries.size() * sizeof(AssetPackEntry));
+	write(paths.data(), paths.size());
+
+	stream.seekp(0);
+	stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	stream.close();
+	if (!stream) throw ExFile("Failed to write asset pack.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), output);
+}
+
+} // namespace Junia
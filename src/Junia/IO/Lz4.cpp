@@ -0,0 +1,198 @@
+/*******************************************************************************
+ *
+ * @file      Lz4.cpp
+ * @brief     Contains the class implementation for the LZ4 block codec
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/Lz4.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/IO/Lz4.cpp";
+
+namespace Junia {
+
+namespace {
+
+constexpr std::size_t MIN_MATCH     = 4;
+constexpr std::size_t LAST_LITERALS = 5;  // the last bytes of a block are always literals
+constexpr std::size_t MATCH_LIMIT   = 12; // a match may not start in the last bytes of a block
+constexpr std::size_t MAX_OFFSET    = 0xFFFF;
+constexpr int         HASH_BITS     = 12;
+
+inline std::uint32_t Read32(const std::uint8_t* p) noexcept {
+	std::uint32_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline std::uint32_t Hash(std::uint32_t sequence) noexcept {
+	return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/**
+ * @brief           write a length that does not fit into the token
+ * @param   length  the remaining length (length - 15)
+ * @param   op      the output position
+ * @param   end     the end of the output buffer
+ * @returns         the new output position or nullptr if the buffer is full
+ */
+inline std::uint8_t* WriteLength(std::size_t length, std::uint8_t* op, std::uint8_t* end) noexcept {
+	for (; length >= 255; length -= 255) {
+		if (op >= end) return nullptr;
+		*op++ = 255;
+	}
+	if (op >= end) return nullptr;
+	*op++ = static_cast<std::uint8_t>(length);
+	return op;
+}
+
+/**
+ * @brief                 write a sequence of literals and an optional match
+ * @param   literals      the first literal
+ * @param   literalLength the number of literals
+ * @param   offset        the match offset (ignored if matchLength is 0)
+ * @param   matchLength   the length of the match or 0 for the last sequence
+ * @param   op            the output position
+ * @param   end           the end of the output buffer
+ * @returns               the new output position or nullptr if the buffer is
+ *                        full
+ */
+std::uint8_t* WriteSequence(const std::uint8_t* literals, std::size_t literalLength, std::size_t offset, std::size_t matchLength, std::uint8_t* op, std::uint8_t* end) noexcept {
+	if (op >= end) return nullptr;
+	std::uint8_t* token = op++;
+	*token              = static_cast<std::uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+	if (literalLength >= 15 && !(op = WriteLength(literalLength - 15, op, end))) return nullptr;
+
+	if (static_cast<std::size_t>(end - op) < literalLength) return nullptr;
+	if (literalLength != 0) std::memcpy(op, literals, literalLength);
+	op += literalLength;
+
+	if (matchLength == 0) return op;
+
+	if (end - op < 2) return nullptr;
+	*op++ = static_cast<std::uint8_t>(offset & 0xFF);
+	*op++ = static_cast<std::uint8_t>(offset >> 8);
+
+	std::size_t code = matchLength - MIN_MATCH;
+	*token |= static_cast<std::uint8_t>(code >= 15 ? 15 : code);
+	if (code >= 15 && !(op = WriteLength(code - 15, op, end))) return nullptr;
+	return op;
+}
+
+} // namespace
+
+std::size_t Lz4::CompressBound(std::size_t size) noexcept {
+	return size + size / 255 + 16;
+}
+
+std::size_t Lz4::Compress(std::span<const std::byte> src, std::span<std::byte> dst) noexcept {
+	const std::uint8_t* base   = reinterpret_cast<const std::uint8_t*>(src.data());
+	const std::uint8_t* ip     = base;
+	const std::uint8_t* anchor = base;
+	const std::uint8_t* end    = base + src.size();
+	std::uint8_t*       op     = reinterpret_cast<std::uint8_t*>(dst.data());
+	std::uint8_t*       opEnd  = op + dst.size();
+
+	if (src.size() > MATCH_LIMIT) {
+		const std::uint8_t* matchLimit = end - MATCH_LIMIT;
+		const std::uint8_t* matchEnd   = end - LAST_LITERALS;
+
+		// positions are stored + 1 so 0 marks an empty slot
+		std::array<std::uint32_t, 1 << HASH_BITS> table {};
+
+		while (ip < matchLimit) {
+			std::uint32_t sequence = Read32(ip);
+			std::uint32_t h        = Hash(sequence);
+			std::size_t   previous = table[h];
+			table[h]               = static_cast<std::uint32_t>(ip - base + 1);
+
+			const std::uint8_t* ref = base + previous - 1;
+			if (previous == 0 || static_cast<std::size_t>(ip - ref) > MAX_OFFSET || Read32(ref) != sequence) {
+				ip++;
+				continue;
+			}
+
+			// extend the match backwards over pending literals and forwards
+			while (ip > anchor && ref > base && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+			}
+			std::size_t length = MIN_MATCH;
+			while (ip + length < matchEnd && ip[length] == ref[length]) length++;
+
+			op = WriteSequence(anchor, ip - anchor, ip - ref, length, op, opEnd);
+			if (!op) return 0;
+
+			ip += length;
+			anchor = ip;
+		}
+	}
+
+	op = WriteSequence(anchor, end - anchor, 0, 0, op, opEnd);
+	if (!op) return 0;
+	return op - reinterpret_cast<std::uint8_t*>(dst.data());
+}
+
+void Lz4::Decompress(std::span<const std::byte> src, std::span<std::byte> dst) {
+	const std::uint8_t* ip    = reinterpret_cast<const std::uint8_t*>(src.data());
+	const std::uint8_t* ipEnd = ip + src.size();
+	std::uint8_t*       base  = reinterpret_cast<std::uint8_t*>(dst.data());
+	std::uint8_t*       op    = base;
+	std::uint8_t*       opEnd = base + dst.size();
+
+	auto offsetOf = [&]() { return static_cast<std::size_t>(ip - reinterpret_cast<const std::uint8_t*>(src.data())); };
+	auto readLength = [&](std::size_t length) {
+		if (length != 15) return length;
+		std::uint8_t b;
+		do {
+			if (ip >= ipEnd) throw ExCompression("Truncated LZ4 block.", nullptr, CodePos(CURRENT_FILE_NAME, "Decompress", __LINE__), offsetOf());
+			b = *ip++;
+			length += b;
+		} while (b == 255);
+		return length;
+	};
+
+	while (true) {
+		if (ip >= ipEnd) throw ExCompression("Truncated LZ4 block.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+		std::uint8_t token = *ip++;
+
+		std::size_t literalLength = readLength(token >> 4);
+		if (static_cast<std::size_t>(ipEnd - ip) < literalLength) throw ExCompression("Literals exceed the LZ4 block.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+		if (static_cast<std::size_t>(opEnd - op) < literalLength) throw ExCompression("Decompressed data exceeds the expected size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+		if (literalLength != 0) std::memcpy(op, ip, literalLength);
+		ip += literalLength;
+		op += literalLength;
+
+		// the last sequence only consists of literals
+		if (ip == ipEnd) break;
+
+		if (ipEnd - ip < 2) throw ExCompression("Truncated LZ4 block.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+		std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8);
+		ip += 2;
+		if (offset == 0 || offset > static_cast<std::size_t>(op - base)) throw ExCompression("Invalid LZ4 match offset.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+
+		std::size_t matchLength = readLength(token & 0x0F) + MIN_MATCH;
+		if (static_cast<std::size_t>(opEnd - op) < matchLength) throw ExCompression("Decompressed data exceeds the expected size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+
+		// matches may overlap the bytes they produce, so copy byte by byte if
+		// the offset is smaller than the length
+		const std::uint8_t* match = op - offset;
+		if (offset >= matchLength) {
+			std::memcpy(op, match, matchLength);
+			op += matchLength;
+		} else {
+			for (std::size_t i = 0; i < matchLength; i++) *op++ = match[i];
+		}
+	}
+
+	if (op != opEnd) throw ExCompression("Decompressed data is smaller than the expected size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetOf());
+}
+
+} // namespace Junia
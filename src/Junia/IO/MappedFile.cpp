@@ -0,0 +1,177 @@
+/*******************************************************************************
+ *
+ * @file      MappedFile.cpp
+ * @brief     Contains the class implementation for read-only memory-mapped
+ *            files
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/MappedFile.hpp>
+
+#include <Junia/Core/StringConvert.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/IO/MappedFile.cpp";
+
+namespace Junia {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() noexcept : data(nullptr), size(0), open(false), mapping(nullptr) { }
+
+MappedFile::MappedFile(const utf8_string& path) : data(nullptr), size(0), open(false), mapping(nullptr) {
+	utf16_string widePath;
+	try {
+		widePath = StringConvert::UTF8ToUTF16(path);
+	} catch (...) {
+		throw ExFile("Invalid file path.", std::current_exception(), CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	}
+
+	HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) throw ExFile("Failed to open file.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize)) {
+		CloseHandle(file);
+		throw ExFile("Failed to query file size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	}
+	this->size = static_cast<std::size_t>(fileSize.QuadPart);
+
+	if (this->size > 0) {
+		this->mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (this->mapping) this->data = static_cast<const std::byte*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+	}
+	CloseHandle(file);
+
+	if (this->size > 0 && !this->data) {
+		this->Close();
+		throw ExFile("Failed to map file.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	}
+	this->open = true;
+}
+
+void MappedFile::Close() noexcept {
+	if (this->data) UnmapViewOfFile(this->data);
+	if (this->mapping) CloseHandle(this->mapping);
+	this->data    = nullptr;
+	this->mapping = nullptr;
+	this->size    = 0;
+	this->open    = false;
+}
+
+void MappedFile::Prefetch(std::size_t offset, std::size_t size) const noexcept {
+	if (offset >= this->size) return;
+	WIN32_MEMORY_RANGE_ENTRY range;
+	range.VirtualAddress = const_cast<std::byte*>(this->data + offset);
+	range.NumberOfBytes  = std::min(size, this->size - offset);
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+	: data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)), open(std::exchange(other.open, false)), mapping(std::exchange(other.mapping, nullptr)) { }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+	if (this != &other) {
+		this->Close();
+		this->data    = std::exchange(other.data, nullptr);
+		this->size    = std::exchange(other.size, 0);
+		this->open    = std::exchange(other.open, false);
+		this->mapping = std::exchange(other.mapping, nullptr);
+	}
+	return *this;
+}
+
+#else
+
+MappedFile::MappedFile() noexcept : data(nullptr), size(0), open(false) { }
+
+MappedFile::MappedFile(const utf8_string& path) : data(nullptr), size(0), open(false) {
+	int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (file < 0) throw ExFile(utf8_string("Failed to open file: ") + std::strerror(errno), nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+
+	struct stat info;
+	if (fstat(file, &info) != 0) {
+		int error = errno;
+		close(file);
+		throw ExFile(utf8_string("Failed to query file size: ") + std::strerror(error), nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+	}
+	this->size = static_cast<std::size_t>(info.st_size);
+
+	if (this->size > 0) {
+		void* address = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (address == MAP_FAILED) {
+			int error = errno;
+			close(file);
+			throw ExFile(utf8_string("Failed to map file: ") + std::strerror(error), nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+		}
+		this->data = static_cast<const std::byte*>(address);
+	}
+	close(file);
+	this->open = true;
+}
+
+void MappedFile::Close() noexcept {
+	if (this->data) munmap(const_cast<std::byte*>(this->data), this->size);
+	this->data = nullptr;
+	this->size = 0;
+	this->open = false;
+}
+
+void MappedFile::Prefetch(std::size_t offset, std::size_t size) const noexcept {
+	if (offset >= this->size) return;
+	static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	std::size_t              begin    = offset - offset % pageSize;
+	std::size_t              end      = offset + std::min(size, this->size - offset);
+	madvise(const_cast<std::byte*>(this->data + begin), end - begin, MADV_WILLNEED);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+	: data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)), open(std::exchange(other.open, false)) { }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+	if (this != &other) {
+		this->Close();
+		this->data = std::exchange(other.data, nullptr);
+		this->size = std::exchange(other.size, 0);
+		this->open = std::exchange(other.open, false);
+	}
+	return *this;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+	this->Close();
+}
+
+bool MappedFile::IsOpen() const noexcept {
+	return this->open;
+}
+
+std::span<const std::byte> MappedFile::GetData() const noexcept {
+	return std::span<const std::byte>(this->data, this->size);
+}
+
+std::size_t MappedFile::GetSize() const noexcept {
+	return this->size;
+}
+
+} // namespace Junia
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *
+ * @file      Path.cpp
+ * @brief     Contains the class implementation for the virtual path helper
+ *            class
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/Path.hpp>
+
+#include <Junia/Core/StringConvert.hpp>
+
+#include <vector>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/IO/Path.cpp";
+
+namespace Junia {
+
+utf8_string Path::Normalize(const utf8_string& path) {
+	// may throw ExUtf8StringEncoding
+	u_string unicode = StringConvert::UTF8ToUnicode(path);
+
+	std::vector<u_string> components;
+	u_string              component;
+	for (std::size_t i = 0; i <= unicode.size(); i++) {
+		ucodepoint_t c = i < unicode.size() ? unicode[i] : U'/';
+		if (c != U'/' && c != U'\\') {
+			component += c;
+			continue;
+		}
+
+		if (component == U"..") {
+			if (components.empty()) throw ExInvalidArgument("Path leaves the root directory.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "path");
+			components.pop_back();
+		} else if (!component.empty() && component != U".") {
+			components.push_back(component);
+		}
+		component.clear();
+	}
+
+	u_string normalized;
+	for (std::size_t i = 0; i < components.size(); i++) {
+		if (i > 0) normalized += U'/';
+		normalized += components[i];
+	}
+
+	return StringConvert::UnicodeToUTF8(normalized);
+}
+
+std::filesystem::path Path::ToNative(const utf8_string& path) {
+	return std::filesystem::path(std::u8string(path.begin(), path.end()));
+}
+
+utf8_string Path::FromNative(const std::filesystem::path& path) {
+	std::u8string utf8 = path.generic_u8string();
+	return utf8_string(utf8.begin(), utf8.end());
+}
+
+} // namespace Junia
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ *
+ * @file      VirtualFileSystem.cpp
+ * @brief     Contains the class implementation for the virtual file system
+ *            that serves assets from mounted asset packs
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/VirtualFileSystem.hpp>
+
+#include <Junia/IO/Lz4.hpp>
+#include <Junia/IO/Path.hpp>
+
+#include <algorithm>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/IO/VirtualFileSystem.cpp";
+
+namespace Junia {
+
+namespace {
+
+std::shared_ptr<const std::vector<std::byte>> Decompress(const AssetPack& pack, const AssetPackEntry& entry) {
+	std::shared_ptr<std::vector<std::byte>> data;
+	try {
+		data = std::make_shared<std::vector<std::byte>>(entry.size);
+	} catch (...) {
+		// std::bad_alloc or std::length_error
+		throw ExAssetPack("Not enough memory to decompress asset.", std::current_exception(), CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(pack.GetPath(entry)));
+	}
+
+	try {
+		Lz4::Decompress(pack.GetStoredData(entry), *data);
+	} catch (...) {
+		throw ExAssetPack("Failed to decompress asset.", std::current_exception(), CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(pack.GetPath(entry)));
+	}
+	return data;
+}
+
+} // namespace
+
+AssetData::AssetData(std::span<const std::byte> view, std::shared_ptr<const std::vector<std::byte>> owner) noexcept
+	: view(view), owner(std::move(owner)) { }
+
+std::span<const std::byte> AssetData::GetData() const noexcept {
+	return this->view;
+}
+
+std::size_t AssetData::GetSize() const noexcept {
+	return this->view.size();
+}
+
+bool AssetData::IsMapped() const noexcept {
+	return this->owner == nullptr;
+}
+
+VirtualFileSystem::VirtualFileSystem() : inFlight(nullptr), stop(false) { }
+
+VirtualFileSystem::~VirtualFileSystem() {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stop = true;
+	}
+	this->queueChanged.notify_all();
+	if (this->thread.joinable()) this->thread.join();
+}
+
+void VirtualFileSystem::Mount(const utf8_string& packPath) {
+	// may throw ExFile or ExAssetPack
+	this->packs.push_back(std::make_unique<AssetPack>(packPath));
+}
+
+VirtualFileSystem::Location VirtualFileSystem::Find(const utf8_string& path) const {
+	utf8_string normalized = Path::Normalize(path);
+	for (auto it = this->packs.rbegin(); it != this->packs.rend(); ++it)
+		if (const AssetPackEntry* entry = (*it)->Find(normalized)) return { it->get(), entry };
+	return { nullptr, nullptr };
+}
+
+bool VirtualFileSystem::Exists(const utf8_string& path) const {
+	return this->Find(path).entry != nullptr;
+}
+
+AssetData VirtualFileSystem::Open(const utf8_string& path) {
+	Location location = this->Find(path);
+	if (!location.entry) throw ExAssetPack("Asset not found.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+
+	if (!location.entry->IsCompressed()) return AssetData(location.pack->GetStoredData(*location.entry));
+
+	{
+		std::unique_lock<std::mutex> lock(this->mutex);
+		// waiters in WaitForPrefetch() may be done once the queue is empty
+		if (std::erase_if(this->queue, [&](const Location& queued) { return queued.entry == location.entry; }) != 0) this->entryFinished.notify_all();
+		this->entryFinished.wait(lock, [&]() { return this->inFlight != location.entry; });
+
+		auto it = this->cache.find(location.entry);
+		if (it != this->cache.end()) {
+			std::shared_ptr<const std::vector<std::byte>> data = std::move(it->second);
+			this->cache.erase(it);
+			return AssetData(*data, data);
+		}
+	}
+
+	// may throw ExAssetPack
+	std::shared_ptr<const std::vector<std::byte>> data = Decompress(*location.pack, *location.entry);
+	return AssetData(*data, data);
+}
+
+void VirtualFileSystem::Prefetch(const utf8_string& path) {
+	Location location = this->Find(path);
+	if (!location.entry) throw ExAssetPack("Asset not found.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), path);
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (!this->thread.joinable()) this->thread = std::thread(&VirtualFileSystem::PrefetchThread, this);
+		this->queue.push_back(location);
+	}
+	this->queueChanged.notify_one();
+}
+
+void VirtualFileSystem::WaitForPrefetch() {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->entryFinished.wait(lock, [&]() { return this->queue.empty() && this->inFlight == nullptr; });
+}
+
+void VirtualFileSystem::ClearPrefetchCache() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->cache.clear();
+}
+
+void VirtualFileSystem::PrefetchThread() {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	while (true) {
+		this->queueChanged.wait(lock, [&]() { return this->stop || !this->queue.empty(); });
+		if (this->stop) return;
+
+		Location location = this->queue.front();
+		this->queue.pop_front();
+		if (location.entry->IsCompressed() && this->cache.contains(location.entry)) {
+			this->entryFinished.notify_all();
+			continue;
+		}
+		this->inFlight = location.entry;
+		lock.unlock();
+
+		std::shared_ptr<const std::vector<std::byte>> data;
+		if (location.entry->IsCompressed()) {
+			// errors are reported when the asset is opened and decompressed
+			// again on the calling thread
+			try {
+				data = Decompress(*location.pack, *location.entry);
+			} catch (...) { }
+		} else {
+			location.pack->GetFile().Prefetch(location.entry->dataOffset, location.entry->storedSize);
+		}
+
+		lock.lock();
+		if (data) this->cache[location.entry] = std::move(data);
+		this->inFlight = nullptr;
+		this->entryFinished.notify_all();
+	}
+}
+
+} // namespace Junia
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * @file      Localization.cpp
+ * @brief     Contains the class implementation for looking up translated
+ *            strings in the current language
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Localization/Localization.hpp>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Localization/Localization.cpp";
+
+namespace Junia {
+
+Localization::Localization() noexcept : current(nullptr) { }
+
+void Localization::Load(const utf8_string& path) {
+	// may throw ExFile or ExLocalization
+	std::unique_ptr<LocalizationTable> table = std::make_unique<LocalizationTable>(path);
+
+	for (const std::unique_ptr<LocalizationTable>& loaded : this->tables)
+		if (loaded->GetLanguage() == table->GetLanguage()) throw ExLocalization("Language is already loaded.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(table->GetLanguage()));
+
+	this->tables.push_back(std::move(table));
+	if (this->current.load(std::memory_order_acquire) == nullptr) this->current.store(this->tables.back().get(), std::memory_order_release);
+}
+
+void Localization::SetLanguage(utf8_string_view language) {
+	for (const std::unique_ptr<LocalizationTable>& table : this->tables) {
+		if (table->GetLanguage() == language) {
+			this->current.store(table.get(), std::memory_order_release);
+			return;
+		}
+	}
+	throw ExLocalization("Language is not loaded.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(language));
+}
+
+utf8_string_view Localization::GetLanguage() const noexcept {
+	const LocalizationTable* table = this->current.load(std::memory_order_acquire);
+	return table ? table->GetLanguage() : utf8_string_view();
+}
+
+std::vector<utf8_string_view> Localization::GetLanguages() const {
+	std::vector<utf8_string_view> languages;
+	for (const std::unique_ptr<LocalizationTable>& table : this->tables) languages.push_back(table->GetLanguage());
+	return languages;
+}
+
+std::optional<LocalizedString> Localization::Find(utf8_string_view key) const noexcept {
+	const LocalizationTable* table = this->current.load(std::memory_order_acquire);
+	if (!table) return std::nullopt;
+	return table->Find(key);
+}
+
+LocalizedString Localization::Get(utf8_string_view key) const {
+	std::optional<LocalizedString> string = this->Find(key);
+	if (!string) throw ExLocalization("Localization key not found.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(key));
+	return *string;
+}
+
+} // namespace Junia
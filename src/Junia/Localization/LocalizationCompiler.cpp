@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * @file      LocalizationCompiler.cpp
+ * @brief     Contains the class implementation for compiling translation
+ *            sources into localization tables
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Localization/LocalizationCompiler.hpp>
+
+#include <Junia/Core/Hash.hpp>
+#include <Junia/Core/StringConvert.hpp>
+#include <Junia/IO/MappedFile.hpp>
+#include <Junia/Localization/LocalizationTable.hpp>
+
+#include <algorithm>
+#include <limits>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Localization/LocalizationCompiler.cpp";
+
+namespace Junia {
+
+namespace {
+
+constexpr std::size_t KEYS_PER_BUCKET = 4;
+
+utf8_string_view Trim(utf8_string_view text) noexcept {
+	while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+	while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) text.remove_suffix(1);
+	return text;
+}
+
+utf8_string ParseValue(utf8_string_view text, std::size_t line) {
+	bool quoted = text.size() >= 2 && text.front() == '"' && text.back() == '"';
+	if (quoted) text = text.substr(1, text.size() - 2);
+
+	utf8_string value;
+	for (std::size_t i = 0; i < text.size(); i++) {
+		if (text[i] == '"' && quoted) throw ExLocalizationSyntax("Unescaped quote in value.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), line);
+		if (text[i] != '\\') {
+			value += text[i];
+			continue;
+		}
+
+		if (++i == text.size()) throw ExLocalizationSyntax("Incomplete escape sequence.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), line);
+		switch (text[i]) {
+			case '\\': value += '\\'; break;
+			case '"': value += '"'; break;
+			case 'n': value += '\n'; break;
+			case 'r': value += '\r'; break;
+			case 't': value += '\t'; break;
+			default: throw ExLocalizationSyntax("Unknown escape sequence.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), line);
+		}
+	}
+	return value;
+}
+
+} // namespace
+
+LocalizationCompiler::LocalizationCompiler(const utf8_string& language) : language(language) { }
+
+void LocalizationCompiler::Add(const utf8_string& key, const utf8_string& value) {
+	if (key.empty()) throw ExLocalization("Localization key is empty.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), key);
+	if (this->keys.contains(key)) throw ExLocalization("Duplicate localization key.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), key);
+
+	// may throw ExUtf8StringEncoding or ExUnicodeStringEncoding
+	StringConvert::UTF8ToUnicode(key);
+	utf16_string utf16 = StringConvert::UTF8ToUTF16(value);
+
+	this->strings.push_back({ key, value, std::move(utf16) });
+	this->keys.insert(key);
+}
+
+void LocalizationCompiler::AddSource(utf8_string_view source) {
+	// skip a UTF-8 byte order mark
+	if (source.starts_with("\xEF\xBB\xBF")) source.remove_prefix(3);
+
+	for (std::size_t line = 1; !source.empty(); line++) {
+		std::size_t      end  = source.find('\n');
+		utf8_string_view text = Trim(source.substr(0, end));
+		source.remove_prefix(end == utf8_string_view::npos ? source.size() : end + 1);
+
+		if (text.empty() || text.front() == '#') continue;
+
+		std::size_t separator = text.find('=');
+		if (separator == utf8_string_view::npos) throw ExLocalizationSyntax("Missing '=' after key.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), line);
+
+		utf8_string key = utf8_string(Trim(text.substr(0, separator)));
+		if (key.empty()) throw ExLocalizationSyntax("Missing key before '='.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), line);
+
+		try {
+			this->Add(key, ParseValue(Trim(text.substr(separator + 1)), line));
+		} catch (const ExStringEncoding&) {
+			throw ExLocalizationSyntax("Line is not valid UTF-8.", std::current_exception(), CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), line);
+		}
+	}
+}
+
+void LocalizationCompiler::AddSourceFile(const utf8_string& path) {
+	// may throw ExFile
+	MappedFile                 file(path);
+	std::span<const std::byte> data = file.GetData();
+	this->AddSource(utf8_string_view(reinterpret_cast<const char*>(data.data()), data.size()));
+}
+
+BinaryRef<LocalizationTableData> LocalizationCompiler::Build(BinaryWriter& writer) const {
+	const std::size_t count   = this->strings.size();
+	const std::size_t buckets = (count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+
+	std::vector<std::uint64_t>            hashes(count);
+	std::vector<std::vector<std::size_t>> bucketKeys(buckets);
+	for (std::size_t i = 0; i < count; i++) {
+		hashes[i] = HashFNV1a64(this->strings[i].key);
+		bucketKeys[LocalizationTableData::GetBucket(hashes[i], buckets)].push_back(i);
+	}
+
+	// keys with equal hashes can never be placed in different slots
+	std::vector<std::uint64_t> sorted = hashes;
+	std::sort(sorted.begin(), sorted.end());
+	if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+		std::uint64_t collision = *std::adjacent_find(sorted.begin(), sorted.end());
+		std::size_t   index     = std::find(hashes.begin(), hashes.end(), collision) - hashes.begin();
+		throw ExLocalization("Localization key hash collision.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), this->strings[index].key);
+	}
+
+	// place the largest buckets first while most slots are still free
+	std::vector<std::size_t> bucketOrder(buckets);
+	for (std::size_t i = 0; i < buckets; i++) bucketOrder[i] = i;
+	std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](std::size_t a, std::size_t b) { return bucketKeys[a].size() > bucketKeys[b].size(); });
+
+	std::vector<std::uint32_t> seeds(buckets, 0);
+	std::vector<std::size_t>   slotOwner(count, count);
+	std::vector<std::size_t>   slots;
+	for (std::size_t bucket : bucketOrder) {
+		const std::vector<std::size_t>& members = bucketKeys[bucket];
+		if (members.empty()) continue;
+
+		bool placed = false;
+		for (std::uint64_t seed = 0; !placed && seed <= std::numeric_limits<std::uint32_t>::max(); seed++) {
+			slots.clear();
+			placed = true;
+			for (std::size_t member : members) {
+				std::size_t slot = LocalizationTableData::GetSlot(hashes[member], static_cast<std::uint32_t>(seed), count);
+				if (slotOwner[slot] != count || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+					placed = false;
+					break;
+				}
+				slots.push_back(slot);
+			}
+			if (placed) {
+				seeds[bucket] = static_cast<std::uint32_t>(seed);
+				for (std::size_t i = 0; i < members.size(); i++) slotOwner[slots[i]] = members[i];
+			}
+		}
+		if (!placed) throw ExLocalization("Failed to build the localization hash index.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), this->strings[members.front()].key);
+	}
+
+	LocalizationTableData header {};
+	header.magic         = LocalizationTableData::MAGIC;
+	header.version       = LocalizationTableData::VERSION;
+	header.utf16UnitSize = sizeof(utf16_string::value_type);
+
+	// may throw ExSerialization
+	BinaryRef<LocalizationTableData> root = writer.Create(header);
+	writer.Set(root, &LocalizationTableData::language, writer.CreateString(this->language));
+	writer.Set(root, &LocalizationTableData::seeds, writer.CreateVector<std::uint32_t>(seeds));
+
+	BinaryVectorRef<LocalizationEntry> entries = writer.CreateVector<LocalizationEntry>(count);
+	writer.Set(root, &LocalizationTableData::entries, entries);
+	for (std::size_t slot = 0; slot < count; slot++) {
+		const PendingString&         string = this->strings[slotOwner[slot]];
+		BinaryRef<LocalizationEntry> entry  = writer.At(entries, slot);
+		writer.Set(entry, &LocalizationEntry::key, writer.CreateString(string.key));
+		writer.Set(entry, &LocalizationEntry::utf8, writer.CreateString(string.utf8));
+		writer.Set(entry, &LocalizationEntry::utf16, writer.CreateVector<utf16_string::value_type>(std::span<const utf16_string::value_type>(string.utf16.c_str(), string.utf16.size() + 1)));
+	}
+
+	return root;
+}
+
+std::vector<std::byte> LocalizationCompiler::Compile() const {
+	BinaryWriter writer;
+	return writer.Finish(this->Build(writer));
+}
+
+void LocalizationCompiler::Compile(const utf8_string& output) const {
+	BinaryWriter writer;
+	writer.Finish(this->Build(writer), output);
+}
+
+} // namespace Junia
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *
+ * @file      LocalizationTable.cpp
+ * @brief     Contains the class implementation for reading localization
+ *            tables
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Localization/LocalizationTable.hpp>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Localization/LocalizationTable.cpp";
+
+namespace Junia {
+
+namespace {
+
+template <typename Source>
+BinaryDocument<LocalizationTableData> OpenDocument(const Source& source) {
+	try {
+		// may throw ExFile
+		return BinaryDocument<LocalizationTableData>(source);
+	} catch (const ExSerialization&) {
+		throw ExLocalization("Invalid localization table.", std::current_exception(), CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "");
+	}
+}
+
+} // namespace
+
+LocalizationTable::LocalizationTable(const utf8_string& path) : document(OpenDocument(path)) {
+	this->Validate();
+}
+
+LocalizationTable::LocalizationTable(std::span<const std::byte> data) : document(OpenDocument(data)) {
+	this->Validate();
+}
+
+void LocalizationTable::Validate() const {
+	const LocalizationTableData& table = this->document.GetRoot();
+
+	if (table.magic != LocalizationTableData::MAGIC) throw ExLocalization("Binary document is not a localization table.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "");
+	if (table.version != LocalizationTableData::VERSION) throw ExLocalization("Unsupported localization table version.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "");
+	if (table.utf16UnitSize != sizeof(utf16_string::value_type)) throw ExLocalization("Localization table was compiled for a different UTF-16 code unit size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "");
+	if (table.entries.Size() > 0 && table.seeds.Size() == 0) throw ExLocalization("Localization table has no hash index.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "");
+
+	// the binary verifier checked all bounds, so only the terminators of the
+	// UTF-16 strings remain to be checked
+	for (const LocalizationEntry& entry : table.entries) {
+		std::span<const utf16_string::value_type> utf16 = entry.utf16.View();
+		if (utf16.empty() || utf16.back() != 0) throw ExLocalization("Localization table string is not terminated.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(entry.key.View()));
+	}
+}
+
+std::optional<LocalizedString> LocalizationTable::Find(utf8_string_view key) const noexcept {
+	const LocalizationTableData& table = this->document.GetRoot();
+	if (table.entries.Size() == 0) return std::nullopt;
+
+	std::uint64_t            hash  = HashFNV1a64(key);
+	std::uint32_t            seed  = table.seeds[LocalizationTableData::GetBucket(hash, table.seeds.Size())];
+	const LocalizationEntry& entry = table.entries[LocalizationTableData::GetSlot(hash, seed, table.entries.Size())];
+
+	// keys that are not in the table map to an arbitrary slot
+	if (entry.key.View() != key) return std::nullopt;
+
+	std::span<const utf16_string::value_type> utf16 = entry.utf16.View();
+	return LocalizedString { entry.utf8.View(), utf16_string_view(utf16.data(), utf16.size() - 1) };
+}
+
+LocalizedString LocalizationTable::Get(utf8_string_view key) const {
+	std::optional<LocalizedString> string = this->Find(key);
+	if (!string) throw ExLocalization("Localization key not found.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), utf8_string(key));
+	return *string;
+}
+
+utf8_string_view LocalizationTable::GetLanguage() const noexcept {
+	return this->document->language.View();
+}
+
+std::size_t LocalizationTable::GetSize() const noexcept {
+	return this->document->entries.Size();
+}
+
+} // namespace Junia
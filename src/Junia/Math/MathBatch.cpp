@@ -0,0 +1,275 @@
+/*******************************************************************************
+ *
+ * @file      MathBatch.cpp
+ * @brief     Contains the class implementation for the batched
+ *            structure-of-arrays math kernels
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Math/MathBatch.hpp>
+
+#include <bit>
+#include <cmath>
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Math/MathBatch.cpp";
+
+namespace Junia {
+
+namespace {
+
+bool HasSize(const ConstVec3SoA& soa, std::size_t count) noexcept {
+	return soa.x.size() == count && soa.y.size() == count && soa.z.size() == count;
+}
+
+bool HasSize(const Vec3SoA& soa, std::size_t count) noexcept {
+	return soa.x.size() == count && soa.y.size() == count && soa.z.size() == count;
+}
+
+/**
+ * @brief        transform vectors with an implicit w component
+ * @tparam W     the w component of every input vector (1 = point,
+ *               0 = direction)
+ * @param matrix the transformation matrix
+ * @param in     the input vectors
+ * @param out    the output vectors
+ */
+template <int W>
+void TransformSoA(const Mat4& matrix, const ConstVec3SoA& in, const Vec3SoA& out) noexcept {
+	const std::size_t count = in.x.size();
+	const float*      ix    = in.x.data();
+	const float*      iy    = in.y.data();
+	const float*      iz    = in.z.data();
+	float*            ox    = out.x.data();
+	float*            oy    = out.y.data();
+	float*            oz    = out.z.data();
+	const Mat4&       m     = matrix;
+	std::size_t       i     = 0;
+
+#if defined(JUNIA_MATH_AVX)
+	const __m256 m00 = _mm256_set1_ps(m[0].x), m01 = _mm256_set1_ps(m[0].y), m02 = _mm256_set1_ps(m[0].z);
+	const __m256 m10 = _mm256_set1_ps(m[1].x), m11 = _mm256_set1_ps(m[1].y), m12 = _mm256_set1_ps(m[1].z);
+	const __m256 m20 = _mm256_set1_ps(m[2].x), m21 = _mm256_set1_ps(m[2].y), m22 = _mm256_set1_ps(m[2].z);
+	const __m256 m30 = _mm256_set1_ps(m[3].x * W), m31 = _mm256_set1_ps(m[3].y * W), m32 = _mm256_set1_ps(m[3].z * W);
+
+	for (; i + 8 <= count; i += 8) {
+		__m256 x = _mm256_loadu_ps(ix + i);
+		__m256 y = _mm256_loadu_ps(iy + i);
+		__m256 z = _mm256_loadu_ps(iz + i);
+		_mm256_storeu_ps(ox + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m00, x), _mm256_mul_ps(m10, y)), _mm256_add_ps(_mm256_mul_ps(m20, z), m30)));
+		_mm256_storeu_ps(oy + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m01, x), _mm256_mul_ps(m11, y)), _mm256_add_ps(_mm256_mul_ps(m21, z), m31)));
+		_mm256_storeu_ps(oz + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m02, x), _mm256_mul_ps(m12, y)), _mm256_add_ps(_mm256_mul_ps(m22, z), m32)));
+	}
+#elif defined(JUNIA_MATH_SSE)
+	const __m128 m00 = _mm_set1_ps(m[0].x), m01 = _mm_set1_ps(m[0].y), m02 = _mm_set1_ps(m[0].z);
+	const __m128 m10 = _mm_set1_ps(m[1].x), m11 = _mm_set1_ps(m[1].y), m12 = _mm_set1_ps(m[1].z);
+	const __m128 m20 = _mm_set1_ps(m[2].x), m21 = _mm_set1_ps(m[2].y), m22 = _mm_set1_ps(m[2].z);
+	const __m128 m30 = _mm_set1_ps(m[3].x * W), m31 = _mm_set1_ps(m[3].y * W), m32 = _mm_set1_ps(m[3].z * W);
+
+	for (; i + 4 <= count; i += 4) {
+		__m128 x = _mm_loadu_ps(ix + i);
+		__m128 y = _mm_loadu_ps(iy + i);
+		__m128 z = _mm_loadu_ps(iz + i);
+		_mm_storeu_ps(ox + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)), _mm_add_ps(_mm_mul_ps(m20, z), m30)));
+		_mm_storeu_ps(oy + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m21, z), m31)));
+		_mm_storeu_ps(oz + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)), _mm_add_ps(_mm_mul_ps(m22, z), m32)));
+	}
+#endif
+
+	for (; i < count; i++) {
+		float x = ix[i], y = iy[i], z = iz[i];
+		ox[i]   = m[0].x * x + m[1].x * y + m[2].x * z + m[3].x * W;
+		oy[i]   = m[0].y * x + m[1].y * y + m[2].y * z + m[3].y * W;
+		oz[i]   = m[0].z * x + m[1].z * y + m[2].z * z + m[3].z * W;
+	}
+}
+
+/**
+ * @brief        multiply two matrices
+ * @param a      the left matrix
+ * @param b      the right matrix
+ * @param result receives a * b. May alias a or b.
+ */
+inline void Multiply(const Mat4& a, const Mat4& b, Mat4& result) noexcept {
+#if defined(JUNIA_MATH_AVX)
+	// every 256 bit register holds two columns of b, so the in-lane permute
+	// broadcasts the k-th element of both columns at once
+	const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a.columns[0].x));
+	const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a.columns[1].x));
+	const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a.columns[2].x));
+	const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a.columns[3].x));
+
+	// all of b is loaded before the first store, so result may alias b
+	__m256 columns[2] = { _mm256_loadu_ps(&b.columns[0].x), _mm256_loadu_ps(&b.columns[2].x) };
+	for (__m256& b01 : columns) {
+		__m256 r = _mm256_mul_ps(a0, _mm256_permute_ps(b01, _MM_SHUFFLE(0, 0, 0, 0)));
+		r        = _mm256_add_ps(r, _mm256_mul_ps(a1, _mm256_permute_ps(b01, _MM_SHUFFLE(1, 1, 1, 1))));
+		r        = _mm256_add_ps(r, _mm256_mul_ps(a2, _mm256_permute_ps(b01, _MM_SHUFFLE(2, 2, 2, 2))));
+		r        = _mm256_add_ps(r, _mm256_mul_ps(a3, _mm256_permute_ps(b01, _MM_SHUFFLE(3, 3, 3, 3))));
+		b01      = r;
+	}
+	_mm256_storeu_ps(&result.columns[0].x, columns[0]);
+	_mm256_storeu_ps(&result.columns[2].x, columns[1]);
+#else
+	result = a * b;
+#endif
+}
+
+/**
+ * @brief           write visibility flags from a comparison bit mask
+ * @param   bits    the bit mask (bit n = element n is visible)
+ * @param   lanes   the number of elements in the mask
+ * @param   visible the output flags
+ * @returns         the number of visible elements
+ */
+inline std::size_t WriteMask(unsigned int bits, int lanes, std::uint8_t* visible) noexcept {
+	for (int l = 0; l < lanes; l++) visible[l] = static_cast<std::uint8_t>((bits >> l) & 1);
+	return static_cast<std::size_t>(std::popcount(bits));
+}
+
+/**
+ * @brief           test spheres or boxes against a frustum
+ * @param   frustum the frustum
+ * @param   centers the centers of the volumes
+ * @param   radius  the radius of every sphere or nullptr
+ * @param   extents the half sizes of every box (ignored if radius is set)
+ * @param   visible the output flags
+ * @returns         the number of visible volumes
+ */
+std::size_t CullSoA(const Frustum& frustum, const ConstVec3SoA& centers, const float* radius, const ConstVec3SoA& extents, std::uint8_t* visible) noexcept {
+	const std::size_t count = centers.x.size();
+	const float*      cx    = centers.x.data();
+	const float*      cy    = centers.y.data();
+	const float*      cz    = centers.z.data();
+	const float*      ex    = extents.x.data();
+	const float*      ey    = extents.y.data();
+	const float*      ez    = extents.z.data();
+	std::size_t       i     = 0;
+	std::size_t       n     = 0;
+
+	Vec4 absPlanes[Frustum::Count];
+	for (int p = 0; p < Frustum::Count; p++) {
+		const Vec4& plane = frustum.planes[p];
+		absPlanes[p]      = Vec4(std::abs(plane.x), std::abs(plane.y), std::abs(plane.z), 0.0f);
+	}
+
+#if defined(JUNIA_MATH_AVX)
+	const __m256 signMask = _mm256_set1_ps(-0.0f);
+	for (; i + 8 <= count; i += 8) {
+		__m256 x = _mm256_loadu_ps(cx + i);
+		__m256 y = _mm256_loadu_ps(cy + i);
+		__m256 z = _mm256_loadu_ps(cz + i);
+		__m256 r = _mm256_setzero_ps(), rx = r, ry = r, rz = r;
+		if (radius) {
+			r = _mm256_xor_ps(_mm256_loadu_ps(radius + i), signMask);
+		} else {
+			rx = _mm256_loadu_ps(ex + i);
+			ry = _mm256_loadu_ps(ey + i);
+			rz = _mm256_loadu_ps(ez + i);
+		}
+
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (int p = 0; p < Frustum::Count; p++) {
+			const Vec4& plane = frustum.planes[p];
+			__m256      d     = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.x), x), _mm256_mul_ps(_mm256_set1_ps(plane.y), y)), _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.z), z), _mm256_set1_ps(plane.w)));
+			if (!radius) {
+				const Vec4& a = absPlanes[p];
+				r             = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(a.x), rx), _mm256_mul_ps(_mm256_set1_ps(a.y), ry)), _mm256_mul_ps(_mm256_set1_ps(a.z), rz));
+				r             = _mm256_xor_ps(r, signMask);
+			}
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, r, _CMP_GE_OQ));
+		}
+		n += WriteMask(static_cast<unsigned int>(_mm256_movemask_ps(inside)), 8, visible + i);
+	}
+#elif defined(JUNIA_MATH_SSE)
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	for (; i + 4 <= count; i += 4) {
+		__m128 x = _mm_loadu_ps(cx + i);
+		__m128 y = _mm_loadu_ps(cy + i);
+		__m128 z = _mm_loadu_ps(cz + i);
+		__m128 r = _mm_setzero_ps(), rx = r, ry = r, rz = r;
+		if (radius) {
+			r = _mm_xor_ps(_mm_loadu_ps(radius + i), signMask);
+		} else {
+			rx = _mm_loadu_ps(ex + i);
+			ry = _mm_loadu_ps(ey + i);
+			rz = _mm_loadu_ps(ez + i);
+		}
+
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int p = 0; p < Frustum::Count; p++) {
+			const Vec4& plane = frustum.planes[p];
+			__m128      d     = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), z), _mm_set1_ps(plane.w)));
+			if (!radius) {
+				const Vec4& a = absPlanes[p];
+				r             = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.x), rx), _mm_mul_ps(_mm_set1_ps(a.y), ry)), _mm_mul_ps(_mm_set1_ps(a.z), rz));
+				r             = _mm_xor_ps(r, signMask);
+			}
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(d, r));
+		}
+		n += WriteMask(static_cast<unsigned int>(_mm_movemask_ps(inside)), 4, visible + i);
+	}
+#endif
+
+	for (; i < count; i++) {
+		bool inside = true;
+		for (int p = 0; p < Frustum::Count && inside; p++) {
+			const Vec4& plane = frustum.planes[p];
+			const Vec4& a     = absPlanes[p];
+			float       r     = radius ? radius[i] : a.x * ex[i] + a.y * ey[i] + a.z * ez[i];
+			inside            = plane.x * cx[i] + plane.y * cy[i] + plane.z * cz[i] + plane.w >= -r;
+		}
+		visible[i] = inside ? 1 : 0;
+		n += inside ? 1 : 0;
+	}
+
+	return n;
+}
+
+} // namespace
+
+void MathBatch::TransformPoints(const Mat4& matrix, ConstVec3SoA in, Vec3SoA out) {
+	if (!HasSize(in, in.x.size()) || !HasSize(out, in.x.size()))
+		throw ExInvalidArgument("Point arrays differ in size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "out");
+	TransformSoA<1>(matrix, in, out);
+}
+
+void MathBatch::TransformVectors(const Mat4& matrix, ConstVec3SoA in, Vec3SoA out) {
+	if (!HasSize(in, in.x.size()) || !HasSize(out, in.x.size()))
+		throw ExInvalidArgument("Vector arrays differ in size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "out");
+	TransformSoA<0>(matrix, in, out);
+}
+
+void MathBatch::ComposeHierarchy(std::span<const Mat4> local, std::span<const std::int32_t> parents, std::span<Mat4> world) {
+	if (parents.size() != local.size() || world.size() != local.size())
+		throw ExInvalidArgument("Hierarchy arrays differ in size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "parents");
+
+	for (std::size_t i = 0; i < local.size(); i++) {
+		std::int32_t parent = parents[i];
+		if (parent < 0) {
+			world[i] = local[i];
+		} else if (static_cast<std::size_t>(parent) < i) {
+			Multiply(world[parent], local[i], world[i]);
+		} else {
+			throw ExInvalidArgument("Parent node is not stored before its child.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "parents");
+		}
+	}
+}
+
+std::size_t MathBatch::CullSpheres(const Frustum& frustum, ConstVec3SoA centers, std::span<const float> radii, std::span<std::uint8_t> visible) {
+	const std::size_t count = centers.x.size();
+	if (!HasSize(centers, count) || radii.size() != count || visible.size() != count)
+		throw ExInvalidArgument("Sphere arrays differ in size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "radii");
+	return CullSoA(frustum, centers, radii.data(), centers, visible.data());
+}
+
+std::size_t MathBatch::CullAABBs(const Frustum& frustum, ConstVec3SoA centers, ConstVec3SoA extents, std::span<std::uint8_t> visible) {
+	const std::size_t count = centers.x.size();
+	if (!HasSize(centers, count) || !HasSize(extents, count) || visible.size() != count)
+		throw ExInvalidArgument("Bounding box arrays differ in size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), "extents");
+	return CullSoA(frustum, centers, nullptr, extents, visible.data());
+}
+
+} // namespace Junia
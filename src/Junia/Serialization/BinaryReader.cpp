@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * @file      BinaryReader.cpp
+ * @brief     Contains the class implementation for verifying binary documents
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Serialization/BinaryReader.hpp>
+
+#include <bit>
+#include <cstring>
+
+static_assert(std::endian::native == std::endian::little, "Binary documents are used in place and require a little-endian target.");
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Serialization/BinaryReader.cpp";
+
+namespace Junia {
+
+namespace {
+
+bool InRange(std::uint64_t offset, std::uint64_t size, std::uint64_t total) noexcept {
+	return offset <= total && size <= total - offset;
+}
+
+} // namespace
+
+BinaryVerifier::BinaryVerifier(std::span<const std::byte> document) : document(document), root(0), references(0) {
+	if (document.size() < sizeof(BinaryHeader)) throw ExSerialization("Data is too small to be a binary document.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), 0);
+	if (reinterpret_cast<std::uintptr_t>(document.data()) % BinaryHeader::MAX_ALIGNMENT != 0) throw ExSerialization("Binary document is not aligned.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), 0);
+
+	const BinaryHeader* header = reinterpret_cast<const BinaryHeader*>(document.data());
+	if (std::memcmp(header->magic, BinaryHeader::MAGIC, sizeof(header->magic)) != 0) throw ExSerialization("Data is not a binary document.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), 0);
+	if (header->version != BinaryHeader::VERSION) throw ExSerialization("Unsupported binary document version.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetof(BinaryHeader, version));
+	if (header->size < sizeof(BinaryHeader) || header->size > document.size()) throw ExSerialization("Binary document is truncated.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetof(BinaryHeader, size));
+	if (header->rootOffset < sizeof(BinaryHeader)) throw ExSerialization("Invalid binary document root.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offsetof(BinaryHeader, rootOffset));
+
+	this->document = document.first(header->size);
+	this->root     = header->rootOffset;
+}
+
+std::span<const std::byte> BinaryVerifier::GetDocument() const noexcept {
+	return this->document;
+}
+
+std::size_t BinaryVerifier::Follow(std::size_t slot, unsigned depth) {
+	std::int32_t relative;
+	std::memcpy(&relative, this->document.data() + slot, sizeof(relative));
+	if (relative == 0) return 0;
+
+	// every reference needs at least 4 bytes, so a document that is not
+	// malicious cannot exceed this budget. Shared or cyclic references could
+	// otherwise make verification arbitrarily slow.
+	if (depth >= MAX_DEPTH) throw ExSerialization("Binary document is nested too deeply.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), slot);
+	if (++this->references > this->document.size() / sizeof(std::int32_t)) throw ExSerialization("Binary document contains too many references.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), slot);
+
+	std::int64_t target = static_cast<std::int64_t>(slot) + relative;
+	if (target < static_cast<std::int64_t>(sizeof(BinaryHeader)) || target >= static_cast<std::int64_t>(this->document.size()))
+		throw ExSerialization("Binary document reference is out of bounds.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), slot);
+	return static_cast<std::size_t>(target);
+}
+
+void BinaryVerifier::CheckObject(std::size_t offset, std::size_t size, std::size_t alignment) const {
+	if (offset % alignment != 0) throw ExSerialization("Binary document object is misaligned.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+	if (!InRange(offset, size, this->document.size())) throw ExSerialization("Binary document object is out of bounds.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+}
+
+void BinaryVerifier::CheckString(std::size_t offset) const {
+	this->CheckObject(offset, sizeof(std::uint32_t), alignof(std::uint32_t));
+
+	std::uint32_t length;
+	std::memcpy(&length, this->document.data() + offset, sizeof(length));
+	if (!InRange(offset + sizeof(length), static_cast<std::uint64_t>(length) + 1, this->document.size())) throw ExSerialization("Binary document string is out of bounds.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+	if (this->document[offset + sizeof(length) + length] != std::byte { 0 }) throw ExSerialization("Binary document string is not terminated.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+}
+
+std::size_t BinaryVerifier::CheckVector(std::size_t offset, std::size_t elementSize, std::size_t elementAlignment) const {
+	this->CheckObject(offset, sizeof(std::uint32_t), alignof(std::uint32_t));
+	if ((offset + sizeof(std::uint32_t)) % elementAlignment != 0) throw ExSerialization("Binary document vector is misaligned.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+
+	std::uint32_t count;
+	std::memcpy(&count, this->document.data() + offset, sizeof(count));
+	if (!InRange(offset + sizeof(count), static_cast<std::uint64_t>(count) * elementSize, this->document.size())) throw ExSerialization("Binary document vector is out of bounds.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+	return count;
+}
+
+} // namespace Junia
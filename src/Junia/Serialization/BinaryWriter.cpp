@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * @file      BinaryWriter.cpp
+ * @brief     Contains the class implementation for building binary documents
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Serialization/BinaryWriter.hpp>
+
+#include <Junia/IO/Path.hpp>
+
+#include <bit>
+#include <fstream>
+#include <limits>
+#include <new>
+
+static_assert(std::endian::native == std::endian::little, "Binary documents are used in place and require a little-endian target.");
+static_assert(__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= Junia::BinaryHeader::MAX_ALIGNMENT, "The document buffer must be allocated with the maximum alignment.");
+
+static constexpr const char* CURRENT_FILE_NAME = "Junia/src/Junia/Serialization/BinaryWriter.cpp";
+
+namespace Junia {
+
+// references are stored as signed 32 bit distances, which must reach every
+// position in the document
+static constexpr std::size_t MAX_DOCUMENT_SIZE = std::numeric_limits<std::int32_t>::max();
+
+BinaryWriter::BinaryWriter() : buffer(sizeof(BinaryHeader)) { }
+
+BinaryStringRef BinaryWriter::CreateString(std::string_view string) {
+	// length prefix, characters and the terminating '\0'
+	std::uint32_t offset = this->Allocate(sizeof(std::uint32_t) + string.size() + 1, alignof(std::uint32_t));
+	std::uint32_t length = static_cast<std::uint32_t>(string.size());
+	std::memcpy(this->buffer.data() + offset, &length, sizeof(length));
+	if (!string.empty()) std::memcpy(this->buffer.data() + offset + sizeof(length), string.data(), string.size());
+	return { offset };
+}
+
+std::uint32_t BinaryWriter::Allocate(std::size_t size, std::size_t alignment, std::size_t alignmentOffset) {
+	std::size_t offset = this->buffer.size();
+	offset += (alignment - (offset + alignmentOffset) % alignment) % alignment;
+	if (size > MAX_DOCUMENT_SIZE || offset > MAX_DOCUMENT_SIZE - size) throw ExSerialization("Binary document exceeds the maximum size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), offset);
+
+	// padding and new objects are zero-initialized, so all references are null
+	this->buffer.resize(offset + size);
+	return static_cast<std::uint32_t>(offset);
+}
+
+std::uint32_t BinaryWriter::AllocateVector(std::size_t count, std::size_t elementSize, std::size_t elementAlignment) {
+	if (elementSize != 0 && count > MAX_DOCUMENT_SIZE / elementSize) throw ExSerialization("Binary vector exceeds the maximum size.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), this->buffer.size());
+
+	// the count directly precedes the elements, which must be aligned
+	std::size_t   alignment = elementAlignment > sizeof(std::uint32_t) ? elementAlignment : sizeof(std::uint32_t);
+	std::uint32_t offset    = this->Allocate(sizeof(std::uint32_t) + count * elementSize, alignment, sizeof(std::uint32_t));
+	std::uint32_t count32   = static_cast<std::uint32_t>(count);
+	std::memcpy(this->buffer.data() + offset, &count32, sizeof(count32));
+	return offset;
+}
+
+void BinaryWriter::Link(std::uint32_t slot, std::uint32_t target) noexcept {
+	// the document is smaller than 2 GiB, so the difference always fits
+	std::int32_t relative = static_cast<std::int32_t>(static_cast<std::int64_t>(target) - static_cast<std::int64_t>(slot));
+	std::memcpy(this->buffer.data() + slot, &relative, sizeof(relative));
+}
+
+std::vector<std::byte> BinaryWriter::FinishDocument(std::uint32_t root) {
+	BinaryHeader header {};
+	std::memcpy(header.magic, BinaryHeader::MAGIC, sizeof(header.magic));
+	header.version    = BinaryHeader::VERSION;
+	header.rootOffset = root;
+	header.size       = static_cast<std::uint32_t>(this->buffer.size());
+	std::memcpy(this->buffer.data(), &header, sizeof(header));
+
+	std::vector<std::byte> document = std::move(this->buffer);
+	this->buffer                    = std::vector<std::byte>(sizeof(BinaryHeader));
+	return document;
+}
+
+void BinaryWriter::WriteDocument(const std::vector<std::byte>& document, const utf8_string& output) {
+	std::ofstream stream(Path::ToNative(output), std::ios::binary | std::ios::trunc);
+	if (!stream) throw ExFile("Failed to create binary document.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), output);
+
+	stream.write(reinterpret_cast<const char*>(document.data()), static_cast<std::streamsize>(document.size()));
+	stream.close();
+	if (!stream) throw ExFile("Failed to write binary document.", nullptr, CodePos(CURRENT_FILE_NAME, __FUNCTION__, __LINE__), output);
+}
+
+} // namespace Junia
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *
+ * @file      JuniaLocalize.cpp
+ * @brief     Contains the command line tool that compiles translation sources
+ *            into a localization table
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/Localization/LocalizationCompiler.hpp>
+
+#include <cstdio>
+
+static void PrintUsage() {
+	std::fprintf(stderr, "usage: JuniaLocalize <language> <output table> <translation source>...\n");
+}
+
+int main(int argc, char** argv) {
+	if (argc < 4) {
+		PrintUsage();
+		return 1;
+	}
+
+	const char* language = argv[1];
+	const char* output   = argv[2];
+	const char* source   = nullptr;
+
+	try {
+		Junia::LocalizationCompiler compiler(language);
+		for (int i = 3; i < argc; i++) {
+			source = argv[i];
+			compiler.AddSourceFile(source);
+		}
+		source = nullptr;
+
+		compiler.Compile(output);
+		std::printf("compiled %d translation sources into '%s'\n", argc - 3, output);
+	} catch (const Junia::ExLocalizationSyntax& ex) {
+		std::fprintf(stderr, "%s:%zu: %s\n", source, ex.GetLine(), ex.GetText(true).c_str());
+		return 1;
+	} catch (const Junia::Exception& ex) {
+		if (source) std::fprintf(stderr, "%s: ", source);
+		std::fprintf(stderr, "%s\n", ex.GetText(true).c_str());
+		return 1;
+	} catch (const std::exception& ex) {
+		std::fprintf(stderr, "%s\n", ex.what());
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * @file      JuniaPack.cpp
+ * @brief     Contains the command line tool that packs a directory into an
+ *            asset pack
+ * @author    Max Hager
+ * @date      19.10.2026
+ * @copyright © Max Hager, 2026. All right reserved.
+ *
+ ******************************************************************************/
+
+#include <Junia/IO/AssetPackWriter.hpp>
+#include <Junia/IO/Path.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string_view>
+
+static void PrintUsage() {
+	std::fprintf(stderr, "usage: JuniaPack [--compress] <output pack> <input directory>\n");
+}
+
+int main(int argc, char** argv) {
+	bool        compress = false;
+	const char* output   = nullptr;
+	const char* input    = nullptr;
+	for (int i = 1; i < argc; i++) {
+		std::string_view arg = argv[i];
+		if (arg == "-c" || arg == "--compress") {
+			compress = true;
+		} else if (!output) {
+			output = argv[i];
+		} else if (!input) {
+			input = argv[i];
+		} else {
+			PrintUsage();
+			return 1;
+		}
+	}
+	if (!output || !input) {
+		PrintUsage();
+		return 1;
+	}
+
+	try {
+		std::filesystem::path  root  = Junia::Path::ToNative(input);
+		Junia::AssetPackWriter writer;
+		std::size_t            count = 0;
+		std::error_code        error;
+		for (std::filesystem::recursive_directory_iterator it(root, error), end; !error && it != end; it.increment(error)) {
+			if (!it->is_regular_file()) continue;
+			Junia::utf8_string path = Junia::Path::FromNative(std::filesystem::relative(it->path(), root));
+			writer.AddFile(path, Junia::Path::FromNative(it->path()), compress);
+			count++;
+		}
+		if (error) {
+			std::fprintf(stderr, "failed to read directory '%s': %s\n", input, error.message().c_str());
+			return 1;
+		}
+
+		writer.Write(output);
+		std::printf("packed %zu assets into '%s'\n", count, output);
+	} catch (const Junia::Exception& ex) {
+		std::fprintf(stderr, "%s\n", ex.GetText(true).c_str());
+		return 1;
+	} catch (const std::exception& ex) {
+		std::fprintf(stderr, "%s\n", ex.what());
+		return 1;
+	}
+
+	return 0;
+}